@@ -3,8 +3,29 @@
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
 
+#include <filesystem>
+#include <optional>
+
 namespace bb {
 
+namespace {
+/**
+ * @brief If `bytecode_path` is a file written by `write_constraint_systems`, load its constraint systems by memory
+ * mapping it (no decompression, nor ACIR parsing).
+ */
+std::optional<std::vector<acir_format::AcirFormat>> try_load_constraint_systems(std::string const& bytecode_path)
+{
+    if (bytecode_path == "-" || std::filesystem::path(bytecode_path).extension() == ".json") {
+        return std::nullopt;
+    }
+    MemoryMappedFile file(bytecode_path);
+    if (!acir_format::is_constraint_systems_buf(file.bytes())) {
+        return std::nullopt;
+    }
+    return acir_format::constraint_systems_buf_to_acir_format(file.bytes());
+}
+} // namespace
+
 acir_format::WitnessVector get_witness(std::string const& witness_path)
 {
     auto witness_data = get_bytecode(witness_path);
@@ -13,6 +34,10 @@ acir_format::WitnessVector get_witness(std::string const& witness_path)
 
 acir_format::AcirFormat get_constraint_system(std::string const& bytecode_path)
 {
+    if (auto constraint_systems = try_load_constraint_systems(bytecode_path)) {
+        // Like circuit_buf_to_acir_format, take the main function of the program.
+        return std::move(constraint_systems->at(0));
+    }
     auto bytecode = get_bytecode(bytecode_path);
     return acir_format::circuit_buf_to_acir_format(std::move(bytecode));
 }
@@ -25,8 +50,16 @@ acir_format::WitnessVectorStack get_witness_stack(std::string const& witness_pat
 
 std::vector<acir_format::AcirFormat> get_constraint_systems(std::string const& bytecode_path)
 {
+    if (auto constraint_systems = try_load_constraint_systems(bytecode_path)) {
+        return std::move(*constraint_systems);
+    }
     auto bytecode = get_bytecode(bytecode_path);
     return acir_format::program_buf_to_acir_format(std::move(bytecode));
 }
 
+void write_constraint_systems(std::string const& bytecode_path, std::string const& output_path)
+{
+    write_file(output_path, acir_format::constraint_systems_to_buf(get_constraint_systems(bytecode_path)));
+}
+
 } // namespace bb
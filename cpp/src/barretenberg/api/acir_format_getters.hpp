@@ -7,4 +7,11 @@ acir_format::WitnessVector get_witness(std::string const& witness_path);
 acir_format::AcirFormat get_constraint_system(std::string const& bytecode_path);
 acir_format::WitnessVectorStack get_witness_stack(std::string const& witness_path);
 std::vector<acir_format::AcirFormat> get_constraint_systems(std::string const& bytecode_path);
+
+/**
+ * @brief Parse the ACIR program at `bytecode_path` once and write its constraint systems to `output_path` in
+ * Barretenberg's binary format. The getters above accept the output in place of the bytecode and load it without
+ * re-parsing.
+ */
+void write_constraint_systems(std::string const& bytecode_path, std::string const& output_path);
 } // namespace bb
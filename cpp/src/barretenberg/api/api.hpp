@@ -23,6 +23,14 @@ class API {
                                    // recursive verifier) or is it for an ivc verifier?
         bool write_vk{ false };    // should we addditionally write the verification key when writing the proof
         bool include_gates_per_opcode{ false }; // should we include gates_per_opcode in the gates command output
+        // should the gates command construct the hash constraints in parallel
+        bool parallel_gadget_construction{ false };
+        // should the gates command skip duplicate arithmetic gates and Poseidon2 permutations
+        bool deduplicate_gates{ false };
+        // should the gates command drop range constraints implied by a tighter one on the same variable
+        bool drop_superseded_range_constraints{ false };
+        // should ClientIVC proving decode the upcoming steps of the ivc inputs while accumulating the current one
+        bool pipelined_accumulation{ false };
 
         friend std::ostream& operator<<(std::ostream& os, const Flags& flags)
         {
@@ -41,6 +49,10 @@ class API {
                << "  verifier_type: " << flags.verifier_type << "\n"
                << "  write_vk " << flags.write_vk << "\n"
                << "  include_gates_per_opcode " << flags.include_gates_per_opcode << "\n"
+               << "  parallel_gadget_construction " << flags.parallel_gadget_construction << "\n"
+               << "  deduplicate_gates " << flags.deduplicate_gates << "\n"
+               << "  drop_superseded_range_constraints " << flags.drop_superseded_range_constraints << "\n"
+               << "  pipelined_accumulation " << flags.pipelined_accumulation << "\n"
                << "]" << std::endl;
             return os;
         }
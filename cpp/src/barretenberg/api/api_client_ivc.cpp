@@ -117,9 +117,13 @@ void ClientIVCAPI::prove(const Flags& flags,
 {
 
     PrivateExecutionSteps steps;
-    steps.parse(PrivateExecutionStepRaw::load_and_decompress(input_path));
-
-    std::shared_ptr<ClientIVC> ivc = steps.accumulate();
+    std::shared_ptr<ClientIVC> ivc;
+    if (flags.pipelined_accumulation) {
+        ivc = steps.accumulate_pipelined(PrivateExecutionStepRaw::load(input_path));
+    } else {
+        steps.parse(PrivateExecutionStepRaw::load_and_decompress(input_path));
+        ivc = steps.accumulate();
+    }
     ClientIVC::Proof proof = ivc->prove();
 
     // We verify this proof. Another bb call to verify has the overhead of loading the SRS,
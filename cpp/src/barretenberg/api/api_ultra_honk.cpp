@@ -239,7 +239,13 @@ void UltraHonkAPI::write_vk(const Flags& flags,
 void UltraHonkAPI::gates([[maybe_unused]] const Flags& flags,
                          [[maybe_unused]] const std::filesystem::path& bytecode_path)
 {
-    gate_count(bytecode_path, /*useless=*/false, flags.honk_recursion, flags.include_gates_per_opcode);
+    gate_count(bytecode_path,
+               /*useless=*/false,
+               flags.honk_recursion,
+               flags.include_gates_per_opcode,
+               flags.parallel_gadget_construction,
+               flags.deduplicate_gates,
+               flags.drop_superseded_range_constraints);
 }
 
 void UltraHonkAPI::write_solidity_verifier(const Flags& flags,
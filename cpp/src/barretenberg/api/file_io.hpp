@@ -7,6 +7,8 @@
 #include <fstream>
 #include <ios>
 #include <iostream>
+#include <span>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <vector>
@@ -84,4 +86,49 @@ inline void write_file(const std::string& filename, std::vector<uint8_t> const&
         file.close();
     }
 }
+
+/**
+ * @brief A read-only memory mapping of a whole file, unmapped on destruction.
+ * @details Pages are only read from disk (or the page cache) as they are accessed, and the data is not copied.
+ */
+class MemoryMappedFile {
+  public:
+    explicit MemoryMappedFile(const std::string& filename)
+    {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd == -1) {
+            THROW std::runtime_error("Unable to open file: " + filename);
+        }
+        struct stat st;
+        if (fstat(fd, &st) == -1) {
+            close(fd);
+            THROW std::runtime_error("Unable to stat file: " + filename);
+        }
+        size = static_cast<size_t>(st.st_size);
+        if (size > 0) {
+            data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        // The mapping stays valid after the descriptor is closed.
+        close(fd);
+        if (data == MAP_FAILED) {
+            THROW std::runtime_error("Failed to memory map file: " + filename + " (" + strerror(errno) + ")");
+        }
+    }
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+    ~MemoryMappedFile()
+    {
+        if (data != nullptr && data != MAP_FAILED) {
+            munmap(data, size);
+        }
+    }
+
+    std::span<const uint8_t> bytes() const { return { static_cast<const uint8_t*>(data), data == nullptr ? 0 : size }; }
+
+  private:
+    void* data = nullptr;
+    size_t size = 0;
+};
 } // namespace bb
@@ -17,7 +17,10 @@ template <typename Builder = UltraCircuitBuilder>
 void gate_count(const std::string& bytecode_path,
                 bool recursive,
                 uint32_t honk_recursion,
-                bool include_gates_per_opcode)
+                bool include_gates_per_opcode,
+                bool parallel_gadget_construction = false,
+                bool deduplicate_gates = false,
+                bool drop_superseded_range_constraints = false)
 {
     // All circuit reports will be built into the string below
     std::string functions_string = "{\"functions\": [\n  ";
@@ -25,7 +28,11 @@ void gate_count(const std::string& bytecode_path,
 
     const acir_format::ProgramMetadata metadata{ .recursive = recursive,
                                                  .honk_recursion = honk_recursion,
-                                                 .collect_gates_per_opcode = include_gates_per_opcode };
+                                                 .collect_gates_per_opcode = include_gates_per_opcode,
+                                                 .parallel_gadget_construction = parallel_gadget_construction,
+                                                 .deduplicate_gates = deduplicate_gates,
+                                                 .drop_superseded_range_constraints =
+                                                     drop_superseded_range_constraints };
     size_t i = 0;
     for (const auto& constraint_system : constraint_systems) {
         acir_format::AcirProgram program{ constraint_system };
@@ -35,12 +42,24 @@ void gate_count(const std::string& bytecode_path,
         vinfo("Calculated circuit size in gate_count: ", circuit_size);
 
         // Build individual circuit report
-        std::string gates_per_opcode_str;
-        for (size_t j = 0; j < program.constraints.gates_per_opcode.size(); j++) {
-            gates_per_opcode_str += std::to_string(program.constraints.gates_per_opcode[j]);
-            if (j != program.constraints.gates_per_opcode.size() - 1) {
-                gates_per_opcode_str += ",";
+        const auto join = [](const std::vector<size_t>& values) {
+            std::string str;
+            for (size_t j = 0; j < values.size(); j++) {
+                str += std::to_string(values[j]);
+                if (j != values.size() - 1) {
+                    str += ",";
+                }
             }
+            return str;
+        };
+        std::string gates_per_opcode_str = join(program.constraints.gates_per_opcode);
+        std::string deduplicated_gates_str =
+            deduplicate_gates ? format(",\n        \"deduplicated_gates\": ", builder.num_deduplicated_gates) : "";
+        if (deduplicate_gates && include_gates_per_opcode) {
+            deduplicated_gates_str = format(deduplicated_gates_str,
+                                            ",\n        \"deduplicated_gates_per_opcode\": [",
+                                            join(program.constraints.deduplicated_gates_per_opcode),
+                                            "]");
         }
 
         auto result_string = format(
@@ -48,6 +67,9 @@ void gate_count(const std::string& bytecode_path,
             program.constraints.num_acir_opcodes,
             ",\n        \"circuit_size\": ",
             circuit_size,
+            ",\n        \"range_constraint_gates_saved\": ",
+            builder.num_range_constraint_gates_saved,
+            deduplicated_gates_str,
             (include_gates_per_opcode ? format(",\n        \"gates_per_opcode\": [", gates_per_opcode_str, "]") : ""),
             "\n  }");
 
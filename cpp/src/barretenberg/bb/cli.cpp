@@ -14,6 +14,7 @@
  * @param argv The argument values array
  * @return int Status code: 0 for success, non-zero for errors or verification failure
  */
+#include "barretenberg/api/acir_format_getters.hpp"
 #include "barretenberg/api/api_avm.hpp"
 #include "barretenberg/api/api_client_ivc.hpp"
 #include "barretenberg/api/api_ultra_honk.hpp"
@@ -129,6 +130,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
     flags.output_format = "bytes";
     flags.crs_path = srs::bb_crs_path();
     flags.include_gates_per_opcode = false;
+    flags.parallel_gadget_construction = false;
+    flags.deduplicate_gates = false;
+    flags.drop_superseded_range_constraints = false;
+    flags.pipelined_accumulation = false;
     const auto add_output_path_option = [&](CLI::App* subcommand, auto& _output_path) {
         return subcommand->add_option("--output_path, -o",
                                       _output_path,
@@ -274,6 +279,35 @@ int parse_and_run_cli_command(int argc, char* argv[])
                                     "Include gates_per_opcode in the output of the gates command.");
     };
 
+    const auto add_parallel_gadget_construction_flag = [&](CLI::App* subcommand) {
+        return subcommand->add_flag("--parallel_gadget_construction",
+                                    flags.parallel_gadget_construction,
+                                    "Construct the hash constraints of an UltraHonk circuit in parallel. The gate "
+                                    "count is unchanged but the gates are ordered differently.");
+    };
+
+    const auto add_deduplicate_gates_flag = [&](CLI::App* subcommand) {
+        return subcommand->add_flag("--deduplicate_gates",
+                                    flags.deduplicate_gates,
+                                    "Skip arithmetic gates and Poseidon2 permutations that duplicate ones already in "
+                                    "the circuit, and report the number of gates saved (per opcode, along with "
+                                    "--include_gates_per_opcode).");
+    };
+
+    const auto add_drop_superseded_range_constraints_flag = [&](CLI::App* subcommand) {
+        return subcommand->add_flag("--drop_superseded_range_constraints",
+                                    flags.drop_superseded_range_constraints,
+                                    "Drop range constraints implied by a tighter one on the same variable. This "
+                                    "shrinks the range lists, so the verification key changes.");
+    };
+
+    const auto add_pipelined_accumulation_flag = [&](CLI::App* subcommand) {
+        return subcommand->add_flag("--pipelined_accumulation",
+                                    flags.pipelined_accumulation,
+                                    "For ClientIVC, decompress and parse the next step of the ivc inputs on a worker "
+                                    "thread while the current step is being accumulated.");
+    };
+
     /***************************************************************************************************************
      * Top-level flags
      ***************************************************************************************************************/
@@ -312,6 +346,9 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_bytecode_path_option(gates);
     add_honk_recursion_option(gates);
     add_include_gates_per_opcode_flag(gates);
+    add_parallel_gadget_construction_flag(gates);
+    add_deduplicate_gates_flag(gates);
+    add_drop_superseded_range_constraints_flag(gates);
 
     /***************************************************************************************************************
      * Subcommand: prove
@@ -335,6 +372,7 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_ipa_accumulation_flag(prove);
     add_recursive_flag(prove);
     add_honk_recursion_option(prove);
+    add_pipelined_accumulation_flag(prove);
 
     prove->add_flag("--verify", "Verify the proof natively, resulting in a boolean output. Useful for testing.");
 
@@ -400,6 +438,20 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_zk_option(write_solidity_verifier);
     add_crs_path_option(write_solidity_verifier);
 
+    /***************************************************************************************************************
+     * Subcommand: write_constraint_systems
+     ***************************************************************************************************************/
+    CLI::App* write_constraint_systems_command =
+        app.add_subcommand("write_constraint_systems",
+                           "Parse the given bytecode once and write its constraint systems in Barretenberg's binary "
+                           "format. The output can be passed as the bytecode of any other subcommand, which then loads "
+                           "it by memory mapping instead of decompressing and parsing the ACIR again.");
+
+    add_verbose_flag(write_constraint_systems_command);
+    add_bytecode_path_option(write_constraint_systems_command);
+    std::string constraint_systems_output_path{ "./target/constraint_systems" };
+    add_output_path_option(write_constraint_systems_command, constraint_systems_output_path);
+
     /***************************************************************************************************************
      * Subcommand: OLD_API
      ***************************************************************************************************************/
@@ -604,6 +656,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        if (write_constraint_systems_command->parsed()) {
+            write_constraint_systems(bytecode_path, constraint_systems_output_path);
+            return 0;
+        }
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
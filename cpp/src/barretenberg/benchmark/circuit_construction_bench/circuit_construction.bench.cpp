@@ -11,7 +11,10 @@ using namespace bb;
 namespace {
 
 auto& engine = numeric::get_debug_randomness();
-void biggroup_construction_bench(State& state)
+/**
+ * @brief Construct a biggroup batch_mul circuit, either recording its gates or only computing its witness
+ */
+void biggroup_construction_bench(State& state, bool witness_only)
 {
     using Curve = stdlib::bn254<UltraCircuitBuilder>;
     using affine_element = Curve::AffineElementNative;
@@ -21,6 +24,7 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
 
         UltraCircuitBuilder builder;
+        builder.witness_only = witness_only;
         size_t num_points = static_cast<size_t>(state.range(0));
         std::vector<affine_element> points;
         std::vector<fr> scalars;
@@ -41,6 +45,7 @@ void biggroup_construction_bench(State& state)
     }
 }
 } // namespace
-BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK_CAPTURE(biggroup_construction_bench, gates, false)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK_CAPTURE(biggroup_construction_bench, witness_only, true)->Unit(kMicrosecond)->DenseRange(2, 20);
 
 BENCHMARK_MAIN();
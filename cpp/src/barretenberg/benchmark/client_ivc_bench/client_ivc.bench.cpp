@@ -4,9 +4,13 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdlib>
 
+#include "barretenberg/client_ivc/private_execution_steps.hpp"
 #include "barretenberg/client_ivc/test_bench_shared.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/common/thread.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -62,10 +66,53 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Ambient_17_in_20)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief End-to-end latency (decompression, parsing, accumulation and proving) of the ivc inputs of a real transaction,
+ * with the steps decoded sequentially (arg 0) or pipelined with accumulation (arg 1)
+ * @details The ivc inputs (as written for `bb prove --scheme client_ivc`) are read from IVC_INPUTS_PATH. The pipelined
+ * mode decodes on one worker thread alongside the proving thread pool, whose size is set by HARDWARE_CONCURRENCY; run
+ * with different values to compare core splits. The sequential mode also reports the time spent decoding.
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, PipelinedAccumulation)(benchmark::State& state)
+{
+    const char* ivc_inputs_path = std::getenv("IVC_INPUTS_PATH");
+    if (ivc_inputs_path == nullptr) {
+        state.SkipWithError("Environment variable IVC_INPUTS_PATH must be set");
+        return;
+    }
+    const bool pipelined = state.range(0) == 1;
+    const auto compressed_steps = PrivateExecutionStepRaw::load(ivc_inputs_path);
+
+    double decode_ms = 0;
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        auto steps = compressed_steps;
+        PrivateExecutionSteps execution_steps;
+        std::shared_ptr<ClientIVC> ivc;
+        if (pipelined) {
+            ivc = execution_steps.accumulate_pipelined(std::move(steps));
+        } else {
+            auto start = std::chrono::steady_clock::now();
+            for (auto& step : steps) {
+                step.decompress();
+            }
+            execution_steps.parse(std::move(steps));
+            decode_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            ivc = execution_steps.accumulate();
+        }
+        ivc->prove();
+    }
+    state.counters["prover_threads"] = static_cast<double>(get_num_cpus());
+    if (!pipelined) {
+        state.counters["decode_ms"] = benchmark::Counter(decode_ms, benchmark::Counter::kAvgIterations);
+    }
+}
+
 #define ARGS Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)->Arg(2)
 
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Ambient_17_in_20)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, PipelinedAccumulation)->Unit(benchmark::kMillisecond)->Arg(0)->Arg(1);
 
 } // namespace
 
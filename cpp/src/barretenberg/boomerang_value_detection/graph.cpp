@@ -561,7 +561,6 @@ template <typename FF> Graph_<FF>::Graph_(bb::UltraCircuitBuilder& ultra_circuit
         variable_adjacency_lists[variable_index] = {};
     }
 
-    std::map<FF, uint32_t> constant_variable_indices = ultra_circuit_constructor.constant_variable_indices;
     auto block_data = ultra_circuit_constructor.blocks.get();
     for (size_t blk_idx = 1; blk_idx < block_data.size() - 1; blk_idx++) {
         if (block_data[blk_idx].size() == 0) {
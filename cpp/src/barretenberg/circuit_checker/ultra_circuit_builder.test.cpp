@@ -871,6 +871,48 @@ TEST(UltraCircuitBuilder, RangeChecksOnDuplicates)
     EXPECT_EQ(result, true);
 }
 
+TEST(UltraCircuitBuilder, SupersededRangeConstraints)
+{
+    const auto add_range_constraints = [](UltraCircuitBuilder& builder) {
+        std::vector<uint32_t> variables;
+        for (size_t i = 0; i < 16; ++i) {
+            variables.emplace_back(builder.add_variable(fr(i * 10)));
+            builder.create_new_range_constraint(variables.back(), 1000);
+        }
+        // A tighter range constraint on a copy of each variable makes the first one redundant
+        for (const auto variable : variables) {
+            builder.create_new_range_constraint(variable, 200);
+        }
+        return variables.size();
+    };
+
+    // Superseded range constraints are kept unless asked otherwise
+    UltraCircuitBuilder default_builder = UltraCircuitBuilder();
+    add_range_constraints(default_builder);
+    EXPECT_TRUE(default_builder.superseded_range_constraints.empty());
+    EXPECT_TRUE(CircuitChecker::check(default_builder));
+    default_builder.finalize_circuit(/*ensure_nonzero=*/false);
+    EXPECT_EQ(default_builder.num_range_constraint_gates_saved, 0UL);
+
+    UltraCircuitBuilder builder = UltraCircuitBuilder();
+    builder.drop_superseded_range_constraints = true;
+    const size_t num_variables = add_range_constraints(builder);
+    EXPECT_EQ(builder.superseded_range_constraints.size(), num_variables);
+
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    builder.finalize_circuit(/*ensure_nonzero=*/false);
+    EXPECT_EQ(builder.num_range_constraint_gates_saved, num_variables / 4);
+    EXPECT_LT(builder.num_gates, default_builder.num_gates);
+
+    // Values are still checked against the tightest range
+    UltraCircuitBuilder failing_builder = UltraCircuitBuilder();
+    failing_builder.drop_superseded_range_constraints = true;
+    const uint32_t variable = failing_builder.add_variable(fr(500));
+    failing_builder.create_new_range_constraint(variable, 1000);
+    failing_builder.create_new_range_constraint(variable, 200);
+    EXPECT_FALSE(CircuitChecker::check(failing_builder));
+}
+
 TEST(UltraCircuitBuilder, CheckCircuitShowcase)
 {
     UltraCircuitBuilder builder = UltraCircuitBuilder();
@@ -907,4 +949,157 @@ TEST(UltraCircuitBuilder, CheckCircuitShowcase)
     EXPECT_EQ(CircuitChecker::check(builder), true);
 }
 
+TEST(UltraCircuitBuilder, WitnessOnly)
+{
+    const fr input_value = fr::random_element(&engine);
+    // Returns the witnesses computed by the gadgets
+    const auto build = [&](UltraCircuitBuilder& builder) {
+        const fr input_lo =
+            static_cast<uint256_t>(input_value).slice(0, plookup::fixed_base::table::BITS_PER_LO_SCALAR);
+        const auto input_lo_index = builder.add_variable(input_lo);
+        const auto sequence_data_lo =
+            plookup::get_lookup_accumulators(plookup::MultiTableId::FIXED_BASE_LEFT_LO, input_lo);
+        auto witnesses = builder.create_gates_from_plookup_accumulators(
+            plookup::MultiTableId::FIXED_BASE_LEFT_LO, sequence_data_lo, input_lo_index)[plookup::ColumnIdx::C2];
+
+        const uint32_t a = builder.add_variable(fr(5));
+        const uint32_t b = builder.add_variable(fr(7));
+        const uint32_t c = builder.add_variable(fr(35));
+        builder.create_mul_gate({ a, b, c, fr(1), fr(-1), fr(0) });
+        builder.range_constrain_two_limbs(a, c, 14, 14);
+        // Non-native field addition and subtraction, limb by limb
+        const auto limb = [](uint32_t x, uint32_t y) {
+            return UltraCircuitBuilder::add_simple{ { x, fr(1) }, { y, fr(2) }, fr(3) };
+        };
+        const std::tuple<uint32_t, uint32_t, fr> prime_limb{ a, c, fr(4) };
+        for (const uint32_t sum : builder.evaluate_non_native_field_addition(
+                 limb(a, b), limb(b, c), limb(c, a), limb(a, a), prime_limb)) {
+            witnesses.push_back(sum);
+        }
+        for (const uint32_t difference : builder.evaluate_non_native_field_subtraction(
+                 limb(a, b), limb(b, c), limb(c, a), limb(a, a), prime_limb)) {
+            witnesses.push_back(difference);
+        }
+        // A placeholder witness gets its value through a copy constraint
+        const uint32_t placeholder = builder.add_variable(fr(0));
+        builder.assert_equal(c, placeholder);
+        witnesses.push_back(placeholder);
+        return witnesses;
+    };
+
+    UltraCircuitBuilder builder;
+    UltraCircuitBuilder witness_builder;
+    witness_builder.witness_only = true;
+    const auto witnesses = build(builder);
+    const auto witness_only_witnesses = build(witness_builder);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // Range lists add variables of their own, so only the values of the computed witnesses are comparable
+    ASSERT_EQ(witness_only_witnesses.size(), witnesses.size());
+    for (size_t i = 0; i < witnesses.size(); ++i) {
+        EXPECT_EQ(witness_builder.get_variable(witness_only_witnesses[i]), builder.get_variable(witnesses[i]));
+    }
+    EXPECT_EQ(witness_builder.get_variable(witness_only_witnesses.back()), fr(35));
+
+    // Only the gate fixing the zero constant, which is added on construction
+    EXPECT_EQ(witness_builder.num_gates, 1UL);
+    EXPECT_TRUE(witness_builder.lookup_tables.empty());
+    EXPECT_TRUE(witness_builder.range_lists.empty());
+
+    // Out of range values are still caught
+    witness_builder.create_new_range_constraint(witness_builder.add_variable(fr(256)), 255);
+    EXPECT_TRUE(witness_builder.failed());
+
+    witness_builder.finalize_circuit(/*ensure_nonzero=*/true);
+    EXPECT_EQ(witness_builder.num_gates, 1UL);
+}
+
+TEST(UltraCircuitBuilder, DeduplicateGates)
+{
+    UltraCircuitBuilder builder;
+    builder.deduplicate_gates = true;
+    const size_t num_gates_before = builder.num_gates;
+
+    const uint32_t a = builder.add_variable(fr(1));
+    const uint32_t b = builder.add_variable(fr(7));
+    const uint32_t c = builder.add_variable(fr(7));
+    builder.create_bool_gate(a);
+    builder.create_bool_gate(a);
+    builder.create_mul_gate({ a, b, c, fr(1), fr(-1), fr(0) });
+    // A gate on a copy of a variable is a duplicate too
+    const uint32_t a_copy = builder.add_variable(fr(1));
+    builder.assert_equal(a, a_copy);
+    builder.create_bool_gate(a_copy);
+    // Constants are only fixed once
+    builder.put_constant_variable(fr(7));
+    builder.put_constant_variable(fr(7));
+    EXPECT_EQ(builder.num_gates - num_gates_before, 3UL);
+    EXPECT_EQ(builder.num_deduplicated_gates, 2UL);
+
+    // A duplicate gate is not skipped when it is the next row of a gate reading w_4 of the next row
+    const uint32_t d = builder.add_variable(fr(8));
+    const add_quad_<fr> gate{ a, b, c, d, fr(1), fr(1), fr(0), fr(-1), fr(0) };
+    builder.create_big_add_gate(gate);
+    builder.create_big_add_gate({ a, b, builder.zero_idx, builder.zero_idx, fr(-1), fr(-1), fr(0), fr(0), fr(0) },
+                                /*include_next_gate_w_4=*/true);
+    builder.create_big_add_gate(gate);
+    builder.create_big_add_gate(gate);
+    EXPECT_EQ(builder.num_gates - num_gates_before, 6UL);
+    EXPECT_EQ(builder.num_deduplicated_gates, 3UL);
+
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
+// Appending a circuit gives the same number of gates as constructing its gates in the builder itself
+TEST(UltraCircuitBuilder, AppendCircuit)
+{
+    const std::vector<fr> witness{ fr(3), fr(4), fr(7), fr(12) };
+    const std::vector<uint32_t> no_public_inputs;
+    const auto add_first_gates = [](UltraCircuitBuilder& builder) {
+        builder.create_add_gate({ 0, 1, 2, fr(1), fr(1), fr(-1), fr(0) });
+        builder.create_range_constraint(0, 8, "");
+    };
+    const auto add_second_gates = [](UltraCircuitBuilder& builder) {
+        builder.create_range_constraint(2, 8, "");
+        builder.create_mul_gate({ 0, 1, 3, fr(1), fr(-1), fr(0) });
+        builder.create_add_gate({ 3, builder.put_constant_variable(fr(5)), builder.add_variable(fr(17)), fr(1), fr(1),
+                                  fr(-1), fr(0) });
+    };
+
+    UltraCircuitBuilder serial_builder(/*size_hint=*/0, witness, no_public_inputs, witness.size());
+    add_first_gates(serial_builder);
+    add_second_gates(serial_builder);
+
+    UltraCircuitBuilder builder(/*size_hint=*/0, witness, no_public_inputs, witness.size());
+    add_first_gates(builder);
+    UltraCircuitBuilder other(/*size_hint=*/0, witness, no_public_inputs, witness.size());
+    add_second_gates(other);
+    builder.append_circuit(std::move(other), witness.size());
+
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+    serial_builder.finalize_circuit(/*ensure_nonzero=*/true);
+    EXPECT_EQ(builder.get_num_finalized_gates(), serial_builder.get_num_finalized_gates());
+}
+
+// ROM/RAM arrays and public inputs are not merged, so appending a circuit that has them must fail rather than drop
+// their constraints
+TEST(UltraCircuitBuilder, AppendCircuitRejectsRomAndPublicInputs)
+{
+    const std::vector<fr> witness{ fr(3), fr(4) };
+    const std::vector<uint32_t> no_public_inputs;
+    UltraCircuitBuilder builder(/*size_hint=*/0, witness, no_public_inputs, witness.size());
+
+    UltraCircuitBuilder rom_builder(/*size_hint=*/0, witness, no_public_inputs, witness.size());
+    const size_t rom_id = rom_builder.create_ROM_array(2);
+    rom_builder.set_ROM_element(rom_id, 0, 0);
+    rom_builder.set_ROM_element(rom_id, 1, 1);
+    rom_builder.read_ROM_array(rom_id, rom_builder.add_variable(fr(1)));
+    EXPECT_THROW(builder.append_circuit(std::move(rom_builder), witness.size()), std::runtime_error);
+
+    UltraCircuitBuilder public_input_builder(/*size_hint=*/0, witness, no_public_inputs, witness.size());
+    public_input_builder.set_public_input(0);
+    EXPECT_THROW(builder.append_circuit(std::move(public_input_builder), witness.size()), std::runtime_error);
+}
+
 } // namespace bb
@@ -186,8 +186,24 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
                            const std::shared_ptr<MegaVerificationKey>& precomputed_vk,
                            const bool mock_vk)
 {
+    // Reuse the precomputed polynomials of this circuit if we have proven it before. A mocked vk does not identify
+    // the circuit, so it can't be used as a key.
+    const bool use_precomputed_cache = precomputed_polynomials_cache && precomputed_vk && !mock_vk;
+    uint256_t precomputed_vk_hash = 0;
+    PrecomputedPolynomialsCache<Flavor>::Entry precomputed = nullptr;
+    if (use_precomputed_cache) {
+        precomputed_vk_hash = precomputed_vk->hash();
+        precomputed = precomputed_polynomials_cache->find(precomputed_vk_hash);
+    }
+
     // Construct the proving key for circuit
-    std::shared_ptr<DeciderProvingKey> proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_settings);
+    std::shared_ptr<DeciderProvingKey> proving_key =
+        std::make_shared<DeciderProvingKey>(circuit, trace_settings, nullptr, precomputed);
+    if (use_precomputed_cache && !precomputed) {
+        auto entry = std::make_shared<PrecomputedPolynomials<Flavor>>(proving_key->proving_key.polynomials,
+                                                                      proving_key->dyadic_circuit_size);
+        precomputed_polynomials_cache->insert(precomputed_vk_hash, std::move(entry));
+    }
 
     // Construct merge proof for the present circuit
     MergeProof merge_proof = goblin.prove_merge();
@@ -17,6 +17,7 @@
 #include "barretenberg/ultra_honk/decider_keys.hpp"
 #include "barretenberg/ultra_honk/decider_prover.hpp"
 #include "barretenberg/ultra_honk/decider_verifier.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomials_cache.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 #include <algorithm>
@@ -169,6 +170,10 @@ class ClientIVC {
 
     std::shared_ptr<typename MegaFlavor::CommitmentKey> bn254_commitment_key;
 
+    // Optional cache of the precomputed polynomials of the circuits being accumulated, keyed by the hash of their
+    // precomputed verification key. Useful when the same circuits are proven many times, e.g. by a long-lived prover.
+    std::shared_ptr<PrecomputedPolynomialsCache<Flavor>> precomputed_polynomials_cache;
+
     Goblin goblin;
 
     bool initialized = false; // Is the IVC accumulator initialized
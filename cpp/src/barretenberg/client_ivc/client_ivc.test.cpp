@@ -301,6 +301,38 @@ TEST_F(ClientIVCTests, StructuredPrecomputedVKs)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief Prove the same set of circuits twice with a shared cache of precomputed polynomials. The second IVC reuses
+ * the cached polynomials of every circuit.
+ *
+ */
+TEST_F(ClientIVCTests, PrecomputedPolynomialsCache)
+{
+    size_t NUM_CIRCUITS = 4;
+    size_t log2_num_gates = 5; // number of gates in baseline mocked circuit
+    TraceSettings trace_settings{ SMALL_TEST_STRUCTURE };
+
+    auto cache = std::make_shared<PrecomputedPolynomialsCache<MegaFlavor>>();
+    auto precomputed_vks =
+        ClientIVCMockCircuitProducer{}.precompute_verification_keys(NUM_CIRCUITS, trace_settings, log2_num_gates);
+
+    for (size_t round = 0; round < 2; ++round) {
+        ClientIVC ivc{ trace_settings };
+        ivc.precomputed_polynomials_cache = cache;
+        ClientIVCMockCircuitProducer circuit_producer;
+        for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+            auto circuit = circuit_producer.create_next_circuit(ivc, log2_num_gates);
+            ivc.accumulate(circuit, precomputed_vks[idx]);
+        }
+        EXPECT_TRUE(ivc.prove_and_verify());
+        EXPECT_EQ(cache->size(), NUM_CIRCUITS);
+        // The first IVC misses and fills the cache, the second one finds every circuit in it.
+        const auto stats = cache->get_stats();
+        EXPECT_EQ(stats.misses, NUM_CIRCUITS);
+        EXPECT_EQ(stats.hits, round * NUM_CIRCUITS);
+    }
+};
+
 /**
  * @brief Produce 2 valid CIVC proofs. Ensure that replacing a proof component with a component from a different proof
  * leads to a verification failure.
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "barretenberg/client_ivc/private_execution_steps.hpp"
+#include "barretenberg/dsl/acir_format/serde/index.hpp"
+
+#include <libdeflate.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Gzip data, as the bytecode and witness of the private execution steps are
+ */
+inline std::vector<uint8_t> gzip_compress(const std::vector<uint8_t>& data)
+{
+    const auto compressor = std::unique_ptr<libdeflate_compressor, void (*)(libdeflate_compressor*)>{
+        libdeflate_alloc_compressor(6), libdeflate_free_compressor
+    };
+    std::vector<uint8_t> compressed(libdeflate_gzip_compress_bound(compressor.get(), data.size()));
+    const size_t size =
+        libdeflate_gzip_compress(compressor.get(), data.data(), data.size(), compressed.data(), compressed.size());
+    compressed.resize(size);
+    return compressed;
+}
+
+/**
+ * @brief A private execution step as returned by PrivateExecutionStepRaw::load(), i.e. with its bytecode and witness
+ * compressed, and without a precomputed vk
+ * @details The program of step i has num_opcodes opcodes, the k-th of which constrains w_{3k+1} * w_{3k+2} = w_{3k+3},
+ * with w_{3k+1} = i + k + 2 and w_{3k+2} = k + 3. Witness 0 is unused.
+ */
+inline PrivateExecutionStepRaw create_mock_private_execution_step(size_t index, size_t num_opcodes = 1)
+{
+    const auto to_acir_field = [](const fr& value) {
+        std::stringstream ss;
+        ss << value;
+        return ss.str();
+    };
+
+    Acir::Circuit circuit{
+        .current_witness_index = static_cast<uint32_t>(3 * num_opcodes),
+        .opcodes = {},
+        .expression_width = Acir::ExpressionWidth{ .value = Acir::ExpressionWidth::Bounded{ .width = 4 } },
+        .private_parameters = {},
+        .public_parameters = Acir::PublicInputs{ .value = {} },
+        .return_values = Acir::PublicInputs{ .value = {} },
+        .assert_messages = {},
+    };
+    Witnesses::WitnessMap witness_map;
+    for (uint32_t k = 0; k < num_opcodes; k++) {
+        const Acir::Witness a{ (3 * k) + 1 };
+        const Acir::Witness b{ (3 * k) + 2 };
+        const Acir::Witness c{ (3 * k) + 3 };
+        Acir::Expression expression{
+            .mul_terms = { { to_acir_field(fr(1)), a, b } },
+            .linear_combinations = { { to_acir_field(-fr(1)), c } },
+            .q_c = to_acir_field(fr(0)),
+        };
+        circuit.opcodes.push_back(Acir::Opcode{ .value = Acir::Opcode::AssertZero{ .value = expression } });
+        circuit.private_parameters.insert(circuit.private_parameters.end(), { a, b, c });
+
+        const fr a_value(index + k + 2);
+        const fr b_value(k + 3);
+        witness_map.value[Witnesses::Witness{ a.value }] = to_acir_field(a_value);
+        witness_map.value[Witnesses::Witness{ b.value }] = to_acir_field(b_value);
+        witness_map.value[Witnesses::Witness{ c.value }] = to_acir_field(a_value * b_value);
+    }
+    const Acir::Program program{ .functions = { circuit }, .unconstrained_functions = {} };
+    const Witnesses::WitnessStack witness_stack{ .stack = { { .index = 0, .witness = witness_map } } };
+
+    return PrivateExecutionStepRaw{
+        .bytecode = gzip_compress(program.bincodeSerialize()),
+        .witness = gzip_compress(witness_stack.bincodeSerialize()),
+        .vk = {},
+        .function_name = "mock_step_" + std::to_string(index),
+    };
+}
+
+} // namespace bb
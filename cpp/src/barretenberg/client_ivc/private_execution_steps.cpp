@@ -1,19 +1,38 @@
 #include "private_execution_steps.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+#include <algorithm>
+#include <future>
 #include <libdeflate.h>
 
 namespace bb {
 
+namespace {
+// Size of a gzip member with empty deflate data: 10 bytes of header and 8 bytes of trailer (CRC32 and size)
+constexpr size_t GZIP_MIN_SIZE = 18;
+// Deflate can't compress by more than this, which bounds the size hint of a corrupt trailer
+constexpr size_t DEFLATE_MAX_RATIO = 1032;
+} // namespace
+
 std::vector<uint8_t> decompress(const void* bytes, size_t size)
 {
+    // Decompressors are reused across calls, one per thread as they can't be shared
+    thread_local const auto decompressor = std::unique_ptr<libdeflate_decompressor, void (*)(libdeflate_decompressor*)>{
+        libdeflate_alloc_decompressor(), libdeflate_free_decompressor
+    };
+
     std::vector<uint8_t> content;
-    // initial size guess
-    content.resize(1024ULL * 128ULL);
+    // Initial size guess: the gzip trailer ends with the size of the uncompressed data (modulo 2^32)
+    size_t size_hint = 0;
+    if (size >= GZIP_MIN_SIZE) {
+        const auto* trailer = static_cast<const uint8_t*>(bytes) + size - 4;
+        size_hint = static_cast<size_t>(trailer[0]) | (static_cast<size_t>(trailer[1]) << 8) |
+                    (static_cast<size_t>(trailer[2]) << 16) | (static_cast<size_t>(trailer[3]) << 24);
+    }
+    size_hint = std::min(size_hint, size * DEFLATE_MAX_RATIO);
+    content.resize(size_hint > 0 ? size_hint : 1024ULL * 128ULL);
     for (;;) {
-        auto decompressor = std::unique_ptr<libdeflate_decompressor, void (*)(libdeflate_decompressor*)>{
-            libdeflate_alloc_decompressor(), libdeflate_free_decompressor
-        };
         size_t actual_size = 0;
         libdeflate_result decompress_result =
             libdeflate_gzip_decompress(decompressor.get(), bytes, size, content.data(), content.size(), &actual_size);
@@ -57,14 +76,22 @@ std::vector<PrivateExecutionStepRaw> PrivateExecutionStepRaw::load_and_decompres
     const std::filesystem::path& input_path)
 {
     PROFILE_THIS();
-    auto raw_steps = unpack_from_file<std::vector<PrivateExecutionStepRaw>>(input_path);
-    for (PrivateExecutionStepRaw& step : raw_steps) {
-        step.bytecode = decompress(step.bytecode.data(), step.bytecode.size());
-        step.witness = decompress(step.witness.data(), step.witness.size());
-    }
+    auto raw_steps = load(input_path);
+    parallel_for(raw_steps.size(), [&](size_t i) { raw_steps[i].decompress(); });
     return raw_steps;
 }
 
+std::vector<PrivateExecutionStepRaw> PrivateExecutionStepRaw::load(const std::filesystem::path& input_path)
+{
+    return unpack_from_file<std::vector<PrivateExecutionStepRaw>>(input_path);
+}
+
+void PrivateExecutionStepRaw::decompress()
+{
+    bytecode = bb::decompress(bytecode.data(), bytecode.size());
+    witness = bb::decompress(witness.data(), witness.size());
+}
+
 std::vector<PrivateExecutionStepRaw> PrivateExecutionStepRaw::parse_uncompressed(const std::vector<uint8_t>& buf)
 {
     std::vector<PrivateExecutionStepRaw> raw_steps;
@@ -83,25 +110,40 @@ void PrivateExecutionSteps::parse(std::vector<PrivateExecutionStepRaw>&& steps)
     precomputed_vks.resize(steps.size());
     function_names.resize(steps.size());
 
-    // https://github.com/AztecProtocol/barretenberg/issues/1395 multithread this once bincode is thread-safe
-    for (size_t i = 0; i < steps.size(); i++) {
-        PrivateExecutionStepRaw step = std::move(steps[i]);
-
-        // TODO(#7371) there is a lot of copying going on in bincode. We need the generated bincode code to
-        // use spans instead of vectors.
-        acir_format::AcirFormat constraints = acir_format::circuit_buf_to_acir_format(std::move(step.bytecode));
-        acir_format::WitnessVector witness = acir_format::witness_buf_to_witness_data(std::move(step.witness));
-
-        folding_stack[i] = { std::move(constraints), std::move(witness) };
-        if (step.vk.empty()) {
-            // For backwards compatibility, but it affects performance and correctness.
-            precomputed_vks[i] = nullptr;
-        } else {
-            auto vk = from_buffer<std::shared_ptr<ClientIVC::MegaVerificationKey>>(step.vk);
-            precomputed_vks[i] = vk;
-        }
-        function_names[i] = step.function_name;
+    // Bincode decoding can run in parallel: its only shared state is the table of cases of each variant type, a
+    // function-local static (see serde.hpp) that is initialized thread-safely and only read afterwards.
+    parallel_for(steps.size(), [&](size_t i) { parse_step(i, std::move(steps[i])); });
+}
+
+void PrivateExecutionSteps::parse_step(size_t i, PrivateExecutionStepRaw&& raw_step)
+{
+    PrivateExecutionStepRaw step = std::move(raw_step);
+
+    // TODO(#7371) there is a lot of copying going on in bincode. We need the generated bincode code to
+    // use spans instead of vectors.
+    acir_format::AcirFormat constraints = acir_format::circuit_buf_to_acir_format(std::move(step.bytecode));
+    acir_format::WitnessVector witness = acir_format::witness_buf_to_witness_data(std::move(step.witness));
+
+    folding_stack[i] = { std::move(constraints), std::move(witness) };
+    if (step.vk.empty()) {
+        // For backwards compatibility, but it affects performance and correctness.
+        precomputed_vks[i] = nullptr;
+    } else {
+        auto vk = from_buffer<std::shared_ptr<ClientIVC::MegaVerificationKey>>(step.vk);
+        precomputed_vks[i] = vk;
     }
+    function_names[i] = step.function_name;
+}
+
+void PrivateExecutionSteps::accumulate_step(ClientIVC& ivc, const acir_format::ProgramMetadata& metadata, size_t i)
+{
+    // Construct a bberg circuit from the acir representation then accumulate it into the IVC
+    auto circuit = acir_format::create_circuit<MegaCircuitBuilder>(folding_stack[i], metadata);
+
+    info("ClientIVC: accumulating " + function_names[i]);
+    // Do one step of ivc accumulator or, if there is only one circuit in the stack, prove that circuit. In this
+    // case, no work is added to the Goblin opqueue, but VM proofs for trivials inputs are produced.
+    ivc.accumulate(circuit, precomputed_vks[i]);
 }
 
 std::shared_ptr<ClientIVC> PrivateExecutionSteps::accumulate()
@@ -119,15 +161,64 @@ std::shared_ptr<ClientIVC> PrivateExecutionSteps::accumulate()
         }
     }
     // Accumulate the entire program stack into the IVC
-    for (auto [program, precomputed_vk, function_name] : zip_view(folding_stack, precomputed_vks, function_names)) {
-        // Construct a bberg circuit from the acir representation then accumulate it into the IVC
-        auto circuit = acir_format::create_circuit<MegaCircuitBuilder>(program, metadata);
-
-        info("ClientIVC: accumulating " + function_name);
-        // Do one step of ivc accumulator or, if there is only one circuit in the stack, prove that circuit. In this
-        // case, no work is added to the Goblin opqueue, but VM proofs for trivials inputs are produced.
-        ivc->accumulate(circuit, precomputed_vk);
+    for (size_t i = 0; i < folding_stack.size(); i++) {
+        accumulate_step(*ivc, metadata, i);
+    }
+
+    return ivc;
+}
+
+std::shared_ptr<ClientIVC> PrivateExecutionSteps::accumulate_pipelined(std::vector<PrivateExecutionStepRaw>&& steps)
+{
+    PROFILE_THIS();
+    TraceSettings trace_settings{ AZTEC_TRACE_STRUCTURE };
+    auto ivc = std::make_shared<ClientIVC>(trace_settings);
+
+    const acir_format::ProgramMetadata metadata{ ivc };
+
+    if (std::any_of(steps.begin(), steps.end(), [](const auto& step) { return step.vk.empty(); })) {
+        info("DEPRECATED: No VK was provided for at least one client IVC step and it will be computed. This is "
+             "slower and insecure.");
+    }
+
+    folding_stack.resize(steps.size());
+    precomputed_vks.resize(steps.size());
+    function_names.resize(steps.size());
+
+    // Decompresses and parses step i. This must not use parallel_for: the thread pool is busy accumulating.
+    const auto decode_step = [&](size_t i) {
+        steps[i].decompress();
+        parse_step(i, std::move(steps[i]));
+    };
+
+#ifdef NO_MULTITHREADING
+    for (size_t i = 0; i < steps.size(); i++) {
+        decode_step(i);
+        accumulate_step(*ivc, metadata, i);
+    }
+#else
+    // Only the decoding of upcoming steps can run ahead: constructing a circuit writes into the Goblin op queue, which
+    // the merge proof of the step being accumulated consumes, and kernels consume the verification queue. A worker
+    // decodes the steps in order, as far ahead of the accumulation as it gets, so each step is accumulated as soon as
+    // it has been decoded.
+    std::vector<std::promise<void>> decoded(steps.size());
+    std::future<void> decoder = std::async(std::launch::async, [&]() {
+        for (size_t i = 0; i < steps.size(); i++) {
+            try {
+                decode_step(i);
+                decoded[i].set_value();
+            } catch (...) {
+                decoded[i].set_exception(std::current_exception());
+                return;
+            }
+        }
+    });
+    for (size_t i = 0; i < steps.size(); i++) {
+        decoded[i].get_future().get();
+        accumulate_step(*ivc, metadata, i);
     }
+    decoder.get();
+#endif
 
     return ivc;
 }
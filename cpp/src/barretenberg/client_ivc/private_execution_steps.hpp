@@ -7,6 +7,9 @@
 
 namespace bb {
 
+// Decompress gzipped data, throwing std::invalid_argument if it is corrupt.
+std::vector<uint8_t> decompress(const void* bytes, size_t size);
+
 /**
  * @brief This is the msgpack encoding of the objects returned by the following typescript:
  *   const stepToStruct = (step: PrivateExecutionStep) => {
@@ -33,6 +36,10 @@ struct PrivateExecutionStepRaw {
     // Unrolled from MSGPACK_FIELDS for custom name for function_name.
     void msgpack(auto pack_fn) { pack_fn(NVP(bytecode, witness, vk), "functionName", function_name); };
     static std::vector<PrivateExecutionStepRaw> load_and_decompress(const std::filesystem::path& input_path);
+    // Load the steps without decompressing their bytecode and witness, see decompress().
+    static std::vector<PrivateExecutionStepRaw> load(const std::filesystem::path& input_path);
+    // Decompress the (gzipped) bytecode and witness of a step obtained from load().
+    void decompress();
     static std::vector<PrivateExecutionStepRaw> parse_uncompressed(const std::vector<uint8_t>& buf);
 };
 
@@ -44,6 +51,19 @@ struct PrivateExecutionSteps {
     std::vector<std::shared_ptr<ClientIVC::MegaVerificationKey>> precomputed_vks;
 
     std::shared_ptr<ClientIVC> accumulate();
+    // Parse the (decompressed) steps, in parallel.
     void parse(std::vector<PrivateExecutionStepRaw>&& steps);
+
+    /**
+     * @brief Decompress, parse and accumulate the steps obtained from PrivateExecutionStepRaw::load(), decoding the
+     * steps lazily on a worker thread that runs ahead of the accumulation.
+     * @details Equivalent to parsing the decompressed steps then calling accumulate(), but each step is accumulated as
+     * soon as it is decoded, so decoding is taken off the critical path (except for the first step).
+     */
+    std::shared_ptr<ClientIVC> accumulate_pipelined(std::vector<PrivateExecutionStepRaw>&& steps);
+
+  private:
+    void parse_step(size_t i, PrivateExecutionStepRaw&& step);
+    void accumulate_step(ClientIVC& ivc, const acir_format::ProgramMetadata& metadata, size_t i);
 };
 } // namespace bb
@@ -0,0 +1,116 @@
+#include "barretenberg/client_ivc/private_execution_steps.hpp"
+#include "barretenberg/client_ivc/mock_private_execution_steps.hpp"
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+std::vector<uint8_t> decompress(const std::vector<uint8_t>& compressed)
+{
+    return bb::decompress(compressed.data(), compressed.size());
+}
+} // namespace
+
+TEST(PrivateExecutionSteps, DecompressEmpty)
+{
+    EXPECT_TRUE(decompress(gzip_compress({})).empty());
+}
+
+// Larger than the 128KiB used when there is no size hint, both compressible and incompressible
+TEST(PrivateExecutionSteps, DecompressLarge)
+{
+    std::vector<uint8_t> compressible(300 * 1024);
+    for (size_t i = 0; i < compressible.size(); i++) {
+        compressible[i] = static_cast<uint8_t>(i % 7);
+    }
+    EXPECT_EQ(decompress(gzip_compress(compressible)), compressible);
+
+    std::vector<uint8_t> incompressible(300 * 1024);
+    for (auto& byte : incompressible) {
+        byte = static_cast<uint8_t>(engine.get_random_uint8());
+    }
+    EXPECT_EQ(decompress(gzip_compress(incompressible)), incompressible);
+}
+
+// The size in the gzip trailer is only used as a hint, but the decompressed data must match it
+TEST(PrivateExecutionSteps, DecompressCorruptTrailer)
+{
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i % 13);
+    }
+    const std::vector<uint8_t> compressed = gzip_compress(data);
+
+    // Trailer claiming a much larger size
+    auto larger = compressed;
+    larger.back() ^= 0xff;
+    EXPECT_THROW(decompress(larger), std::invalid_argument);
+
+    // Trailer claiming a smaller size
+    auto smaller = compressed;
+    smaller[smaller.size() - 4] = 0xf4; // 500 instead of 1000
+    smaller[smaller.size() - 3] = 0x01;
+    EXPECT_THROW(decompress(smaller), std::invalid_argument);
+
+    // Bad CRC
+    auto bad_crc = compressed;
+    bad_crc[bad_crc.size() - 8] ^= 0xff;
+    EXPECT_THROW(decompress(bad_crc), std::invalid_argument);
+
+    // Truncated, shorter than a gzip header and trailer
+    const std::vector<uint8_t> truncated(compressed.begin(), compressed.begin() + 10);
+    EXPECT_THROW(decompress(truncated), std::invalid_argument);
+}
+
+// Steps are decompressed and parsed in parallel, which relies on bincode decoding being thread-safe. The result must be
+// the same as decoding each step on its own.
+TEST(PrivateExecutionSteps, ParallelLoadAndParse)
+{
+    constexpr size_t NUM_STEPS = 16;
+    std::vector<PrivateExecutionStepRaw> steps;
+    for (size_t i = 0; i < NUM_STEPS; i++) {
+        steps.push_back(create_mock_private_execution_step(i, /*num_opcodes=*/i + 1));
+    }
+
+    const std::filesystem::path input_path =
+        std::filesystem::temp_directory_path() / "private_execution_steps_test_ivc_inputs.msgpack";
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, steps);
+        std::ofstream file(input_path, std::ios::binary);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    std::vector<PrivateExecutionStepRaw> loaded_steps = PrivateExecutionStepRaw::load_and_decompress(input_path);
+    std::filesystem::remove(input_path);
+
+    ASSERT_EQ(loaded_steps.size(), NUM_STEPS);
+    for (size_t i = 0; i < NUM_STEPS; i++) {
+        EXPECT_EQ(loaded_steps[i].bytecode, decompress(steps[i].bytecode));
+        EXPECT_EQ(loaded_steps[i].witness, decompress(steps[i].witness));
+        EXPECT_EQ(loaded_steps[i].function_name, steps[i].function_name);
+    }
+
+    PrivateExecutionSteps parsed_steps;
+    parsed_steps.parse(std::move(loaded_steps));
+
+    ASSERT_EQ(parsed_steps.folding_stack.size(), NUM_STEPS);
+    for (size_t i = 0; i < NUM_STEPS; i++) {
+        const auto constraints = acir_format::circuit_buf_to_acir_format(decompress(steps[i].bytecode));
+        const auto witness = acir_format::witness_buf_to_witness_data(decompress(steps[i].witness));
+        EXPECT_EQ(parsed_steps.folding_stack[i].constraints, constraints);
+        EXPECT_EQ(parsed_steps.folding_stack[i].witness, witness);
+        EXPECT_EQ(parsed_steps.folding_stack[i].constraints.poly_triple_constraints.size(), i + 1);
+        EXPECT_EQ(parsed_steps.function_names[i], steps[i].function_name);
+        EXPECT_EQ(parsed_steps.precomputed_vks[i], nullptr);
+    }
+}
@@ -11,7 +11,9 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <random>
@@ -34,6 +36,31 @@ namespace bb::crypto::merkle_tree {
 
 using namespace bb;
 
+/**
+ * @brief Returns the zero hashes of a tree of the given depth whose empty leaves have the value zero_leaf, indexed by
+ * level with the root at 0. These are computed once per depth and shared by all tree instances, so that constructing
+ * a tree, e.g. for every newly created fork, does not re-hash the empty sub-trees.
+ */
+template <typename HashingPolicy> const std::vector<fr>& get_zero_hashes(uint32_t depth, const fr& zero_leaf)
+{
+    static std::mutex mtx;
+    static std::map<std::pair<uint32_t, uint256_t>, std::vector<fr>> cache;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto [it, inserted] = cache.try_emplace(std::make_pair(depth, uint256_t(zero_leaf)));
+    if (inserted) {
+        std::vector<fr>& hashes = it->second;
+        hashes.resize(depth + 1);
+        fr current = zero_leaf;
+        for (size_t i = depth; i > 0; --i) {
+            hashes[i] = current;
+            current = HashingPolicy::hash_pair(current, current);
+        }
+        hashes[0] = current;
+    }
+    // Entries are never removed and std::map references remain valid across insertions
+    return it->second;
+}
+
 /**
  * @brief Implements a simple append-only merkle tree
  * All methods are asynchronous unless specified as otherwise
@@ -291,17 +318,8 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     // start by reading the meta data from the backing store
     store_->get_meta(meta);
     depth_ = meta.depth;
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = HashingPolicy::zero_hash();
-    for (size_t i = depth_; i > 0; --i) {
-        // std::cout << "Zero hash at " << i << " : " << current << std::endl;
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
-    // std::cout << "Zero root: " << current << std::endl;
+    zero_hashes_ = get_zero_hashes<HashingPolicy>(depth_, HashingPolicy::zero_hash());
+    fr current = zero_hashes_[0];
 
     max_size_ = numeric::pow64(2, depth_);
     // if root is non-zero it means the tree has already been initialized
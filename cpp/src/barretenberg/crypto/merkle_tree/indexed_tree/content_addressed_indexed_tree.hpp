@@ -292,15 +292,7 @@ ContentAddressedIndexedTree<Store, HashingPolicy>::ContentAddressedIndexedTree(
     if (prefilled_values.size() > initial_size) {
         throw std::runtime_error("Number of prefilled values can't be more than initial size");
     }
-    zero_hashes_.resize(depth_ + 1);
-
-    // Create the zero hashes for the tree
-    auto current = fr::zero();
-    for (uint32_t i = depth_; i > 0; --i) {
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
+    zero_hashes_ = get_zero_hashes<HashingPolicy>(depth_, fr::zero());
 
     TreeMeta meta;
     store_->get_meta(meta);
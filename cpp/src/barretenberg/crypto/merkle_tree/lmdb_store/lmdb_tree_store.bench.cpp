@@ -0,0 +1,104 @@
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_layout.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+const size_t NUM_RECORDS = 1 << 14;
+
+using LeafType = IndexedLeaf<PublicDataLeafValue>;
+
+struct StoreFixture {
+    std::string directory = random_temp_directory();
+    LMDBTreeStore::SharedPtr store;
+    std::vector<fr> keys;
+
+    StoreFixture()
+    {
+        std::filesystem::create_directories(directory);
+        store = std::make_shared<LMDBTreeStore>(directory, random_string(), 1024 * 1024, 16);
+        keys.resize(NUM_RECORDS);
+        LMDBTreeStore::WriteTransaction::Ptr tx = store->create_write_transaction();
+        for (size_t i = 0; i < NUM_RECORDS; ++i) {
+            keys[i] = fr(random_engine.get_random_uint256());
+            NodePayload node{ .left = fr(random_engine.get_random_uint256()),
+                              .right = fr(random_engine.get_random_uint256()),
+                              .ref = 1 };
+            store->write_node(keys[i], node, *tx);
+            LeafType leaf(PublicDataLeafValue(keys[i], fr(i)), i + 1, fr(random_engine.get_random_uint256()));
+            store->write_leaf_by_hash(keys[i], leaf, *tx);
+        }
+        tx->commit();
+    }
+    StoreFixture(const StoreFixture&) = delete;
+    StoreFixture(StoreFixture&&) = delete;
+    StoreFixture& operator=(const StoreFixture&) = delete;
+    StoreFixture& operator=(StoreFixture&&) = delete;
+    ~StoreFixture() { std::filesystem::remove_all(directory); }
+};
+
+void lmdb_store_read_node(State& state) noexcept
+{
+    StoreFixture fixture;
+    LMDBTreeStore::ReadTransaction::Ptr tx = fixture.store->create_read_transaction();
+    size_t i = 0;
+    for (auto _ : state) {
+        NodePayload node;
+        fixture.store->read_node(fixture.keys[i++ % NUM_RECORDS], node, *tx);
+        DoNotOptimize(node);
+    }
+}
+BENCHMARK(lmdb_store_read_node);
+
+void lmdb_store_read_leaf_by_hash(State& state) noexcept
+{
+    StoreFixture fixture;
+    LMDBTreeStore::ReadTransaction::Ptr tx = fixture.store->create_read_transaction();
+    size_t i = 0;
+    for (auto _ : state) {
+        LeafType leaf;
+        fixture.store->read_leaf_by_hash(fixture.keys[i++ % NUM_RECORDS], leaf, *tx);
+        DoNotOptimize(leaf);
+    }
+}
+BENCHMARK(lmdb_store_read_leaf_by_hash);
+
+// Decoding cost alone, for comparison between the fixed layout and the legacy msgpack encoding
+template <bool FixedLayout> void lmdb_store_decode_node(State& state) noexcept
+{
+    NodePayload node{ .left = fr(random_engine.get_random_uint256()),
+                      .right = fr(random_engine.get_random_uint256()),
+                      .ref = 1 };
+    std::vector<uint8_t> encoded;
+    if constexpr (FixedLayout) {
+        record_layout::encode_record(node, encoded);
+    } else {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, node);
+        encoded.assign(buffer.data(), buffer.data() + buffer.size());
+    }
+    MDB_val view;
+    view.mv_size = encoded.size();
+    view.mv_data = (void*)encoded.data();
+    for (auto _ : state) {
+        NodePayload decoded;
+        record_layout::decode_record(view, decoded);
+        DoNotOptimize(decoded);
+    }
+}
+BENCHMARK(lmdb_store_decode_node<true>);
+BENCHMARK(lmdb_store_decode_node<false>);
+
+} // namespace
+
+BENCHMARK_MAIN();
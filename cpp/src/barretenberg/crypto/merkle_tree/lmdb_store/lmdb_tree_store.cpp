@@ -133,10 +133,10 @@ bool LMDBTreeStore::read_block_data(const block_number_t& blockNumber,
                                     LMDBTreeStore::ReadTransaction& tx)
 {
     BlockMetaKeyType key(blockNumber);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<BlockMetaKeyType>(key, data, *_blockDatabase);
+    MDB_val data;
+    bool success = tx.get_value_view<BlockMetaKeyType>(key, data, *_blockDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(blockData);
+        record_layout::decode_record(data, blockData);
     }
     return success;
 }
@@ -315,20 +315,13 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
-    FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
-    }
-    return success;
+    return get_node_data(nodeHash, nodeData, tx);
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    record_layout::encode_record(nodeData, encoded);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
@@ -8,6 +8,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_layout.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -66,6 +67,40 @@ struct NodePayload {
     }
 };
 
+namespace record_layout {
+/**
+ * Nodes are laid out as: tag | presence flags | left | right | ref count
+ * An absent child is written as zeros and flagged as such
+ */
+template <> struct FixedLayout<NodePayload> {
+    static constexpr bool enabled = true;
+    static constexpr size_t SIZE = 1 + 1 + FR_SIZE + FR_SIZE + sizeof(uint64_t);
+    static constexpr uint8_t LEFT_PRESENT = 1;
+    static constexpr uint8_t RIGHT_PRESENT = 2;
+
+    static void encode(const NodePayload& node, uint8_t* it)
+    {
+        uint8_t flags = (node.left.has_value() ? LEFT_PRESENT : 0) | (node.right.has_value() ? RIGHT_PRESENT : 0);
+        *it++ = flags;
+        write_fr(it, node.left.value_or(fr::zero()));
+        write_fr(it, node.right.value_or(fr::zero()));
+        write_u64(it, node.ref);
+    }
+
+    static void decode(const uint8_t* it, NodePayload& node)
+    {
+        uint8_t flags = *it++;
+        fr left;
+        fr right;
+        read_fr(it, left);
+        read_fr(it, right);
+        node.left = (flags & LEFT_PRESENT) != 0 ? std::optional<fr>(left) : std::nullopt;
+        node.right = (flags & RIGHT_PRESENT) != 0 ? std::optional<fr>(right) : std::nullopt;
+        read_u64(it, node.ref);
+    }
+};
+} // namespace record_layout
+
 struct BlockIndexPayload {
     std::vector<block_number_t> blockNumbers;
 
@@ -238,6 +273,13 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     void delete_all_leaf_keys_before_or_equal_index(const index_t& index, WriteTransaction& tx);
 
+    /**
+     * @brief Re-writes any node and leaf pre-image records still held in the legacy msgpack encoding using the fixed
+     * record layout. Legacy records remain readable without this, it simply front-loads the conversion.
+     * @return The number of records re-written
+     */
+    template <typename LeafType> uint64_t migrate_record_layout();
+
   private:
     std::string _name;
     LMDBDatabase::Ptr _blockDatabase;
@@ -247,6 +289,8 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _indexToBlockDatabase;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
+    template <typename RecordType> uint64_t migrate_database(const LMDBDatabase& db, WriteTransaction& tx);
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx)
@@ -259,10 +303,10 @@ template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
+    MDB_val data;
+    bool success = tx.template get_value_view<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+        record_layout::decode_record(data, leafData);
     }
     return success;
 }
@@ -270,9 +314,8 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    record_layout::encode_record(leafData, encoded);
     FrKeyType key(leafHash);
     tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
 }
@@ -280,11 +323,70 @@ void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafD
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
+    MDB_val data;
+    bool success = tx.template get_value_view<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        record_layout::decode_record(data, nodeData);
     }
     return success;
 }
+
+template <typename LeafType> uint64_t LMDBTreeStore::migrate_record_layout()
+{
+    uint64_t migrated = 0;
+    WriteTransaction::Ptr tx = create_write_transaction();
+    try {
+        migrated += migrate_database<NodePayload>(*_nodeDatabase, *tx);
+        migrated += migrate_database<IndexedLeaf<LeafType>>(*_leafHashToPreImageDatabase, *tx);
+        tx->commit();
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw std::runtime_error(format("Unable to migrate record layout for tree: ", _name, " Error: ", e.what()));
+    }
+    return migrated;
+}
+
+template <typename RecordType>
+uint64_t LMDBTreeStore::migrate_database(const LMDBDatabase& db, WriteTransaction& tx)
+{
+    if constexpr (!record_layout::FixedLayout<RecordType>::enabled) {
+        return 0;
+    } else {
+        uint64_t migrated = 0;
+        MDB_cursor* cursor = nullptr;
+        call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+        try {
+            MDB_val dbKey;
+            MDB_val dbVal;
+            int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_FIRST);
+            while (code == MDB_SUCCESS) {
+                if (!record_layout::is_fixed_layout<RecordType>(dbVal)) {
+                    RecordType record;
+                    record_layout::decode_record(dbVal, record);
+                    std::vector<uint8_t> encoded;
+                    record_layout::encode_record(record, encoded);
+                    MDB_val newVal;
+                    newVal.mv_size = encoded.size();
+                    newVal.mv_data = (void*)encoded.data();
+                    call_lmdb_func("mdb_cursor_put",
+                                   mdb_cursor_put,
+                                   cursor,
+                                   &dbKey,
+                                   &newVal,
+                                   static_cast<unsigned int>(MDB_CURRENT));
+                    ++migrated;
+                }
+                code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_NEXT);
+            }
+            if (code != MDB_NOTFOUND) {
+                throw_error("migrate_database::mdb_cursor_get", code);
+            }
+        } catch (std::exception&) {
+            call_lmdb_func(mdb_cursor_close, cursor);
+            throw;
+        }
+        call_lmdb_func(mdb_cursor_close, cursor);
+        return migrated;
+    }
+}
 } // namespace bb::crypto::merkle_tree
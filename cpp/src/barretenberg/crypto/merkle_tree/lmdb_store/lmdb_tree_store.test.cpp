@@ -631,3 +631,61 @@ TEST_F(LMDBTreeStoreTest, reports_physical_file_size)
         }
     }
 }
+
+TEST_F(LMDBTreeStoreTest, can_decode_legacy_msgpack_records)
+{
+    // Records written before the fixed layout was introduced are msgpack encoded and must remain readable
+    auto decode_legacy = [](const auto& original, auto& readBack) {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, original);
+        MDB_val view;
+        view.mv_size = buffer.size();
+        view.mv_data = (void*)buffer.data();
+        EXPECT_FALSE(record_layout::is_fixed_layout<std::decay_t<decltype(original)>>(view));
+        record_layout::decode_record(view, readBack);
+    };
+
+    NodePayload node{ .left = VALUES[0], .right = std::nullopt, .ref = 7 };
+    NodePayload nodeReadBack;
+    decode_legacy(node, nodeReadBack);
+    EXPECT_EQ(nodeReadBack, node);
+
+    IndexedLeaf<PublicDataLeafValue> leaf(PublicDataLeafValue(VALUES[1], VALUES[2]), 5, VALUES[3]);
+    IndexedLeaf<PublicDataLeafValue> leafReadBack;
+    decode_legacy(leaf, leafReadBack);
+    EXPECT_EQ(leafReadBack, leaf);
+}
+
+TEST_F(LMDBTreeStoreTest, writes_and_reads_fixed_layout_records)
+{
+    std::vector<NodePayload> nodes{
+        { .left = VALUES[4], .right = VALUES[5], .ref = 4 },
+        { .left = std::nullopt, .right = VALUES[5], .ref = 1 },
+        { .left = VALUES[4], .right = std::nullopt, .ref = 2 },
+    };
+    IndexedLeaf<NullifierLeafValue> leaf(NullifierLeafValue(VALUES[7]), 12, VALUES[8]);
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (size_t i = 0; i < nodes.size(); i++) {
+            store.write_node(VALUES[10 + i], nodes[i], *transaction);
+        }
+        store.write_leaf_by_hash(VALUES[20], leaf, *transaction);
+        transaction->commit();
+    }
+
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (size_t i = 0; i < nodes.size(); i++) {
+            NodePayload readBack;
+            EXPECT_TRUE(store.read_node(VALUES[10 + i], readBack, *transaction));
+            EXPECT_EQ(readBack, nodes[i]);
+        }
+        IndexedLeaf<NullifierLeafValue> leafReadBack;
+        EXPECT_TRUE(store.read_leaf_by_hash(VALUES[20], leafReadBack, *transaction));
+        EXPECT_EQ(leafReadBack, leaf);
+    }
+
+    // Everything was written in the fixed layout so there is nothing to migrate
+    EXPECT_EQ(store.migrate_record_layout<NullifierLeafValue>(), 0);
+}
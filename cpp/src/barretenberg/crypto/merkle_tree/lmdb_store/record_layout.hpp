@@ -0,0 +1,152 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include "lmdb.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * Fixed-layout binary encodings for the hot record types of the tree store.
+ *
+ * Records with a FixedLayout specialisation are written as a tag byte followed by their fields at fixed offsets, and
+ * are decoded directly from the value view returned by LMDB, avoiding both the copy out of the memory map and the
+ * msgpack decode. All other records continue to be msgpack encoded.
+ *
+ * The tag byte (0xc1) is never emitted by msgpack, so records written by previous versions of the store are still
+ * recognised and decoded via msgpack. Such records are re-written in the fixed layout the next time they are updated,
+ * or eagerly via LMDBTreeStore::migrate_record_layout.
+ *
+ * Field elements are stored in their canonical (non-Montgomery) form, integers in little-endian byte order.
+ */
+namespace record_layout {
+
+const uint8_t FIXED_LAYOUT_TAG = 0xc1;
+const size_t FR_SIZE = 32;
+const size_t INDEX_SIZE = sizeof(index_t);
+
+inline void write_fr(uint8_t*& it, const fr& value)
+{
+    uint256_t canonical(value);
+    std::memcpy(it, canonical.data, FR_SIZE);
+    it += FR_SIZE;
+}
+
+inline void read_fr(const uint8_t*& it, fr& value)
+{
+    uint256_t canonical;
+    std::memcpy(canonical.data, it, FR_SIZE);
+    value = fr(canonical);
+    it += FR_SIZE;
+}
+
+inline void write_u64(uint8_t*& it, uint64_t value)
+{
+    std::memcpy(it, &value, sizeof(value));
+    it += sizeof(value);
+}
+
+inline void read_u64(const uint8_t*& it, uint64_t& value)
+{
+    std::memcpy(&value, it, sizeof(value));
+    it += sizeof(value);
+}
+
+/**
+ * @brief Describes the fixed layout of a record type. SIZE includes the tag byte, encode/decode operate on the bytes
+ * that follow it.
+ */
+template <typename T> struct FixedLayout {
+    static constexpr bool enabled = false;
+};
+
+template <> struct FixedLayout<IndexedLeaf<NullifierLeafValue>> {
+    static constexpr bool enabled = true;
+    static constexpr size_t SIZE = 1 + FR_SIZE + INDEX_SIZE + FR_SIZE;
+
+    static void encode(const IndexedLeaf<NullifierLeafValue>& leaf, uint8_t* it)
+    {
+        write_fr(it, leaf.leaf.nullifier);
+        write_u64(it, leaf.nextIndex);
+        write_fr(it, leaf.nextKey);
+    }
+
+    static void decode(const uint8_t* it, IndexedLeaf<NullifierLeafValue>& leaf)
+    {
+        read_fr(it, leaf.leaf.nullifier);
+        read_u64(it, leaf.nextIndex);
+        read_fr(it, leaf.nextKey);
+    }
+};
+
+template <> struct FixedLayout<IndexedLeaf<PublicDataLeafValue>> {
+    static constexpr bool enabled = true;
+    static constexpr size_t SIZE = 1 + FR_SIZE + FR_SIZE + INDEX_SIZE + FR_SIZE;
+
+    static void encode(const IndexedLeaf<PublicDataLeafValue>& leaf, uint8_t* it)
+    {
+        write_fr(it, leaf.leaf.slot);
+        write_fr(it, leaf.leaf.value);
+        write_u64(it, leaf.nextIndex);
+        write_fr(it, leaf.nextKey);
+    }
+
+    static void decode(const uint8_t* it, IndexedLeaf<PublicDataLeafValue>& leaf)
+    {
+        read_fr(it, leaf.leaf.slot);
+        read_fr(it, leaf.leaf.value);
+        read_u64(it, leaf.nextIndex);
+        read_fr(it, leaf.nextKey);
+    }
+};
+
+template <typename T> bool is_fixed_layout(const MDB_val& view)
+{
+    if constexpr (FixedLayout<T>::enabled) {
+        return view.mv_size == FixedLayout<T>::SIZE &&
+               static_cast<const uint8_t*>(view.mv_data)[0] == FIXED_LAYOUT_TAG;
+    } else {
+        return false;
+    }
+}
+
+template <typename T> void encode_record(const T& value, std::vector<uint8_t>& buffer)
+{
+    if constexpr (FixedLayout<T>::enabled) {
+        buffer.resize(FixedLayout<T>::SIZE);
+        buffer[0] = FIXED_LAYOUT_TAG;
+        FixedLayout<T>::encode(value, buffer.data() + 1);
+    } else {
+        msgpack::sbuffer packed;
+        msgpack::pack(packed, value);
+        buffer.assign(packed.data(), packed.data() + packed.size());
+    }
+}
+
+template <typename T> void decode_record(const MDB_val& view, T& value)
+{
+    const auto* data = static_cast<const uint8_t*>(view.mv_data);
+    if constexpr (FixedLayout<T>::enabled) {
+        if (is_fixed_layout<T>(view)) {
+            FixedLayout<T>::decode(data + 1, value);
+            return;
+        }
+    }
+    // Either the type has no fixed layout or this is a legacy msgpack encoded record
+    msgpack::unpack(reinterpret_cast<const char*>(data), view.mv_size).get().convert(value);
+}
+
+} // namespace record_layout
+} // namespace bb::crypto::merkle_tree
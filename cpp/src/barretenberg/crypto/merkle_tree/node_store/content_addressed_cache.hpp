@@ -84,6 +84,8 @@ template <typename LeafValueType> class ContentAddressedCache {
         TreeMeta meta_;
         // Captures the cache's node hashes at the time of checkpoint. If the node does not exist in the cache, the
         // optional will == nullopt
+        // The per-level maps are only allocated on the first node update after the checkpoint, so that creating and
+        // reverting/committing checkpoints that touch no nodes is cheap
         // TODO (PhilWindle): Consider where a more optimal approach is a single unordered map, instead of 1 per level
         std::vector<std::unordered_map<index_t, std::optional<fr>>> nodes_by_index_;
         // Captures the cache's leaf pre-images at the time of checkpoint. Again, if the leaf does not exist in the
@@ -94,7 +96,6 @@ template <typename LeafValueType> class ContentAddressedCache {
 
         Journal(TreeMeta meta)
             : meta_(std::move(meta))
-            , nodes_by_index_(meta_.depth + 1, std::unordered_map<index_t, std::optional<fr>>())
         {}
     };
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
@@ -126,7 +127,7 @@ template <typename LeafValueType> ContentAddressedCache<LeafValueType>::ContentA
 
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::checkpoint()
 {
-    journals_.emplace_back(Journal(meta_));
+    journals_.emplace_back(meta_);
 }
 
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::revert()
@@ -194,6 +195,11 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
     Journal& current_journal = journals_.back();
     Journal& previous_journal = journals_[journals_.size() - 2];
 
+    if (previous_journal.nodes_by_index_.empty()) {
+        // The previous journal has not captured any nodes, it simply takes ownership of ours
+        std::swap(previous_journal.nodes_by_index_, current_journal.nodes_by_index_);
+    }
+
     for (uint32_t i = 0; i < current_journal.nodes_by_index_.size(); ++i) {
         for (const auto& [index, optional_node_hash] : current_journal.nodes_by_index_[i]) {
             // There is an entry in the current journal, if it does not exist in the previous journal then we need to
@@ -438,6 +444,9 @@ void ContentAddressedCache<LeafValueType>::put_node_by_index(uint32_t level, con
 
     // There is a journal, grab it
     Journal& journal = journals_.back();
+    if (journal.nodes_by_index_.empty()) {
+        journal.nodes_by_index_.resize(nodes_by_index_.size());
+    }
 
     // If there is no node at the given location then add a nullopt to the journal
     auto cacheIter = nodes_by_index_[level].find(index);
@@ -139,6 +139,32 @@ TEST_F(ContentAddressedCacheTest, commit_then_revert_nodes)
     EXPECT_FALSE(cache.get_node_by_index(level, index).has_value());
 }
 
+TEST_F(ContentAddressedCacheTest, commit_into_checkpoint_without_node_updates)
+{
+    CacheType cache = create_cache(10);
+    uint32_t level = 5;
+    uint64_t index = 15;
+    fr original_hash = fr::random_element();
+    cache.put_node_by_index(level, index, original_hash);
+
+    // The outer checkpoint captures no node updates of its own
+    cache.checkpoint();
+    cache.checkpoint();
+    fr updated_hash = fr::random_element();
+    cache.put_node_by_index(level, index, updated_hash);
+    cache.put_node_by_index(level + 1, index, updated_hash);
+
+    // Committing the inner checkpoint hands its captured nodes to the outer one
+    cache.commit();
+    EXPECT_EQ(cache.get_node_by_index(level, index).value(), updated_hash);
+    EXPECT_EQ(cache.get_node_by_index(level + 1, index).value(), updated_hash);
+
+    // Reverting the outer checkpoint restores the original state
+    cache.revert();
+    EXPECT_EQ(cache.get_node_by_index(level, index).value(), original_hash);
+    EXPECT_FALSE(cache.get_node_by_index(level + 1, index).has_value());
+}
+
 TEST_F(ContentAddressedCacheTest, commit_then_commit_nodes)
 {
     CacheType cache = create_cache(10);
@@ -8,6 +8,7 @@
 
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/ivc_recursion_constraint.hpp"
 #include "barretenberg/dsl/acir_format/proof_surgeon.hpp"
@@ -23,7 +24,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 
 namespace acir_format {
 
@@ -46,6 +49,61 @@ template <typename Builder> struct HonkRecursionConstraintsOutput {
     bool is_root_rollup = false;
 };
 
+/**
+ * @brief Construct the aes128, sha256, blake and keccak constraints in parallel and append them to the builder
+ * @details Each sub-builder is constructed from the ACIR witness and gets a contiguous run of the gadgets, in the order
+ * in which they are constructed serially. The partition does not depend on the number of threads, so neither does the
+ * circuit. Each sub-builder holds a copy of the ACIR witness, which bounds the number of sub-builders. ECDSA is not
+ * constructed here since it uses ROM tables, which append_circuit does not merge.
+ */
+template <typename Builder>
+void create_gadget_constraints_in_parallel(Builder& builder, AcirProgram& program)
+{
+    PROFILE_THIS();
+    constexpr size_t MAX_NUM_SUB_BUILDERS = 16;
+    const AcirFormat& constraint_system = program.constraints;
+
+    std::vector<std::function<void(Builder&)>> gadgets;
+    for (const auto& constraint : constraint_system.aes128_constraints) {
+        gadgets.emplace_back([&](Builder& sub_builder) { create_aes128_constraints(sub_builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.sha256_compression) {
+        gadgets.emplace_back(
+            [&](Builder& sub_builder) { create_sha256_compression_constraints(sub_builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.blake2s_constraints) {
+        gadgets.emplace_back([&](Builder& sub_builder) { create_blake2s_constraints(sub_builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.blake3_constraints) {
+        gadgets.emplace_back([&](Builder& sub_builder) { create_blake3_constraints(sub_builder, constraint); });
+    }
+    for (const auto& constraint : constraint_system.keccak_permutations) {
+        gadgets.emplace_back([&](Builder& sub_builder) { create_keccak_permutations(sub_builder, constraint); });
+    }
+    if (gadgets.empty()) {
+        return;
+    }
+
+    const size_t num_sub_builders = std::min(gadgets.size(), MAX_NUM_SUB_BUILDERS);
+    std::vector<std::optional<Builder>> sub_builders(num_sub_builders);
+    parallel_for(num_sub_builders, [&](size_t i) {
+        const std::vector<uint32_t> no_public_inputs;
+        auto& sub_builder =
+            sub_builders[i].emplace(/*size_hint=*/0, program.witness, no_public_inputs, constraint_system.varnum);
+        sub_builder.deduplicate_gates = builder.deduplicate_gates;
+        sub_builder.drop_superseded_range_constraints = builder.drop_superseded_range_constraints;
+        sub_builder.witness_only = builder.witness_only;
+        const size_t start = i * gadgets.size() / num_sub_builders;
+        const size_t end = (i + 1) * gadgets.size() / num_sub_builders;
+        for (size_t j = start; j < end; ++j) {
+            gadgets[j](sub_builder);
+        }
+    });
+    for (auto& sub_builder : sub_builders) {
+        builder.append_circuit(std::move(*sub_builder), constraint_system.varnum);
+    }
+}
+
 template <typename Builder>
 void build_constraints(Builder& builder, AcirProgram& program, const ProgramMetadata& metadata)
 {
@@ -54,11 +112,19 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
     bool collect_gates_per_opcode = metadata.collect_gates_per_opcode;
     AcirFormat& constraint_system = program.constraints;
 
+    builder.deduplicate_gates = metadata.deduplicate_gates;
+    builder.drop_superseded_range_constraints = metadata.drop_superseded_range_constraints;
+    builder.witness_only = metadata.witness_only;
     if (collect_gates_per_opcode) {
         constraint_system.gates_per_opcode.resize(constraint_system.num_acir_opcodes, 0);
+        if (metadata.deduplicate_gates) {
+            constraint_system.deduplicated_gates_per_opcode.resize(constraint_system.num_acir_opcodes, 0);
+        }
     }
 
-    GateCounter gate_counter{ &builder, collect_gates_per_opcode };
+    GateCounter gate_counter{ &builder,
+                              collect_gates_per_opcode,
+                              metadata.deduplicate_gates ? &constraint_system.deduplicated_gates_per_opcode : nullptr };
 
     // Add arithmetic gates
     for (size_t i = 0; i < constraint_system.poly_triple_constraints.size(); ++i) {
@@ -123,60 +189,76 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
                                 constraint_system.original_opcode_indices.range_constraints.at(i));
     }
 
-    // Add aes128 constraints
-    for (size_t i = 0; i < constraint_system.aes128_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.aes128_constraints.at(i);
-        create_aes128_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.aes128_constraints.at(i));
-    }
+    const auto create_ecdsa_constraints = [&]() {
+        // Add ECDSA k1 constraints
+        for (size_t i = 0; i < constraint_system.ecdsa_k1_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.ecdsa_k1_constraints.at(i);
+            create_ecdsa_k1_verify_constraints(builder, constraint, has_valid_witness_assignments);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.ecdsa_k1_constraints.at(i));
+        }
 
-    // Add sha256 constraints
-    for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
-        const auto& constraint = constraint_system.sha256_compression[i];
-        create_sha256_compression_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.sha256_compression[i]);
+        // Add ECDSA r1 constraints
+        for (size_t i = 0; i < constraint_system.ecdsa_r1_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.ecdsa_r1_constraints.at(i);
+            create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.ecdsa_r1_constraints.at(i));
+        }
+    };
+
+    // The hash gadgets are self-contained, so they can be constructed in parallel (unless we need the gates of each
+    // opcode). ECDSA is always constructed in the builder itself.
+    bool parallel_gadget_construction = false;
+    if constexpr (IsUltraBuilder<Builder>) {
+        parallel_gadget_construction = metadata.parallel_gadget_construction && !collect_gates_per_opcode;
+        if (parallel_gadget_construction) {
+            create_gadget_constraints_in_parallel(builder, program);
+            create_ecdsa_constraints();
+        }
     }
+    if (!parallel_gadget_construction) {
+        // Add aes128 constraints
+        for (size_t i = 0; i < constraint_system.aes128_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.aes128_constraints.at(i);
+            create_aes128_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.aes128_constraints.at(i));
+        }
 
-    // Add ECDSA k1 constraints
-    for (size_t i = 0; i < constraint_system.ecdsa_k1_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.ecdsa_k1_constraints.at(i);
-        create_ecdsa_k1_verify_constraints(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ecdsa_k1_constraints.at(i));
-    }
+        // Add sha256 constraints
+        for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
+            const auto& constraint = constraint_system.sha256_compression[i];
+            create_sha256_compression_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.sha256_compression[i]);
+        }
 
-    // Add ECDSA r1 constraints
-    for (size_t i = 0; i < constraint_system.ecdsa_r1_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.ecdsa_r1_constraints.at(i);
-        create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ecdsa_r1_constraints.at(i));
-    }
+        create_ecdsa_constraints();
 
-    // Add blake2s constraints
-    for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.blake2s_constraints.at(i);
-        create_blake2s_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake2s_constraints.at(i));
-    }
+        // Add blake2s constraints
+        for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.blake2s_constraints.at(i);
+            create_blake2s_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.blake2s_constraints.at(i));
+        }
 
-    // Add blake3 constraints
-    for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.blake3_constraints.at(i);
-        create_blake3_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake3_constraints.at(i));
-    }
+        // Add blake3 constraints
+        for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.blake3_constraints.at(i);
+            create_blake3_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.blake3_constraints.at(i));
+        }
 
-    // Add keccak permutations
-    for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
-        const auto& constraint = constraint_system.keccak_permutations[i];
-        create_keccak_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.keccak_permutations[i]);
+        // Add keccak permutations
+        for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
+            const auto& constraint = constraint_system.keccak_permutations[i];
+            create_keccak_permutations(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.keccak_permutations[i]);
+        }
     }
 
     for (size_t i = 0; i < constraint_system.poseidon2_constraints.size(); ++i) {
@@ -207,10 +289,14 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
         const auto& constraint = constraint_system.block_constraints.at(i);
         create_block_constraints(builder, constraint, has_valid_witness_assignments);
         if (collect_gates_per_opcode) {
-            size_t avg_gates_per_opcode =
-                gate_counter.compute_diff() / constraint_system.original_opcode_indices.block_constraints.at(i).size();
+            const size_t num_opcodes = constraint_system.original_opcode_indices.block_constraints.at(i).size();
+            size_t avg_gates_per_opcode = gate_counter.compute_diff() / num_opcodes;
+            size_t avg_deduplicated_gates_per_opcode = gate_counter.compute_deduplicated_diff() / num_opcodes;
             for (size_t opcode_index : constraint_system.original_opcode_indices.block_constraints.at(i)) {
                 constraint_system.gates_per_opcode[opcode_index] = avg_gates_per_opcode;
+                if (metadata.deduplicate_gates) {
+                    constraint_system.deduplicated_gates_per_opcode[opcode_index] = avg_deduplicated_gates_per_opcode;
+                }
             }
         }
     }
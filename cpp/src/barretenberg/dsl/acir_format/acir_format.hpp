@@ -67,6 +67,29 @@ struct AcirFormatOriginalOpcodeIndices {
     // Multiple opcode indices per block:
     std::vector<std::vector<size_t>> block_constraints;
 
+    MSGPACK_FIELDS(logic_constraints,
+                   range_constraints,
+                   aes128_constraints,
+                   sha256_compression,
+                   ecdsa_k1_constraints,
+                   ecdsa_r1_constraints,
+                   blake2s_constraints,
+                   blake3_constraints,
+                   keccak_permutations,
+                   poseidon2_constraints,
+                   multi_scalar_mul_constraints,
+                   ec_add_constraints,
+                   recursion_constraints,
+                   honk_recursion_constraints,
+                   avm_recursion_constraints,
+                   ivc_recursion_constraints,
+                   bigint_from_le_bytes_constraints,
+                   bigint_to_le_bytes_constraints,
+                   bigint_operations,
+                   assert_equalities,
+                   poly_triple_constraints,
+                   quad_constraints,
+                   block_constraints);
     friend bool operator==(AcirFormatOriginalOpcodeIndices const& lhs,
                            AcirFormatOriginalOpcodeIndices const& rhs) = default;
 };
@@ -122,6 +145,8 @@ struct AcirFormat {
     // Number of gates added to the circuit per original opcode.
     // Has length equal to num_acir_opcodes.
     std::vector<size_t> gates_per_opcode = {};
+    // Number of gates saved by gate deduplication per original opcode (only collected along with gates_per_opcode).
+    std::vector<size_t> deduplicated_gates_per_opcode = {};
 
     // Set of constrained witnesses
     std::set<uint32_t> constrained_witness = {};
@@ -217,6 +242,19 @@ struct ProgramMetadata {
                                  // 2 means we are using the UltraRollupHonk flavor
     bool collect_gates_per_opcode = false;
     size_t size_hint = 0;
+    // Construct the hash constraints of an Ultra circuit in parallel. The resulting circuit is equivalent
+    // (and has the same size) but its gates are ordered differently, so its verification key differs.
+    bool parallel_gadget_construction = false;
+    // Skip arithmetic gates and Poseidon2 permutations identical to ones already in the circuit (see
+    // UltraCircuitBuilder_::deduplicate_gates). This shrinks the circuit, so its verification key differs.
+    bool deduplicate_gates = false;
+    // Drop range constraints implied by a tighter one on the same variable (see
+    // UltraCircuitBuilder_::drop_superseded_range_constraints). This shrinks the circuit, so its verification key
+    // differs.
+    bool drop_superseded_range_constraints = false;
+    // Only compute the witness: gates, lookup tables and range lists are not recorded (see
+    // UltraCircuitBuilder_::witness_only). The resulting builder can't be proven.
+    bool witness_only = false;
 };
 
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1161) Refactor this function
@@ -247,9 +285,12 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
  */
 template <typename Builder> class GateCounter {
   public:
-    GateCounter(Builder* builder, bool collect_gates_per_opcode)
+    GateCounter(Builder* builder,
+                bool collect_gates_per_opcode,
+                std::vector<size_t>* deduplicated_gates_per_opcode = nullptr)
         : builder(builder)
         , collect_gates_per_opcode(collect_gates_per_opcode)
+        , deduplicated_gates_per_opcode(deduplicated_gates_per_opcode)
     {}
 
     size_t compute_diff()
@@ -263,17 +304,33 @@ template <typename Builder> class GateCounter {
         return diff;
     }
 
+    // The number of gates deduplication saved since the last call
+    size_t compute_deduplicated_diff()
+    {
+        if (!collect_gates_per_opcode) {
+            return 0;
+        }
+        size_t diff = builder->num_deduplicated_gates - prev_num_deduplicated_gates;
+        prev_num_deduplicated_gates = builder->num_deduplicated_gates;
+        return diff;
+    }
+
     void track_diff(std::vector<size_t>& gates_per_opcode, size_t opcode_index)
     {
         if (collect_gates_per_opcode) {
             gates_per_opcode[opcode_index] = compute_diff();
+            if (deduplicated_gates_per_opcode != nullptr) {
+                (*deduplicated_gates_per_opcode)[opcode_index] = compute_deduplicated_diff();
+            }
         }
     }
 
   private:
     Builder* builder;
     bool collect_gates_per_opcode;
+    std::vector<size_t>* deduplicated_gates_per_opcode;
     size_t prev_gate_count{};
+    size_t prev_num_deduplicated_gates{};
 };
 
 } // namespace acir_format
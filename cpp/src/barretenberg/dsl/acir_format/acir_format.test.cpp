@@ -4,6 +4,7 @@
 
 #include "acir_format.hpp"
 #include "acir_format_mocks.hpp"
+#include "acir_to_constraint_buf.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/op_queue/ecc_op_queue.hpp"
 
@@ -74,6 +75,65 @@ TEST_F(AcirFormatTests, MsgpackLogicConstraint)
     auto [actual, expected] = msgpack_roundtrip(LogicConstraint{});
     EXPECT_EQ(actual, expected);
 }
+
+TEST_F(AcirFormatTests, ConstraintSystemsBufRoundtrip)
+{
+    RangeConstraint range{ .witness = 0, .num_bits = 32 };
+    poly_triple constraint{
+        .a = 0, .b = 1, .c = 2, .q_m = 0, .q_l = 1, .q_r = 1, .q_o = -1, .q_c = 0,
+    };
+    // A ROM array [12], read at index 0 into witness 2
+    poly_triple twelve{ .a = 0, .b = 0, .c = 0, .q_m = 0, .q_l = 0, .q_r = 0, .q_o = 0, .q_c = 12 };
+    poly_triple zero{ .a = 0, .b = 0, .c = 0, .q_m = 0, .q_l = 0, .q_r = 0, .q_o = 0, .q_c = 0 };
+    poly_triple w2{ .a = 2, .b = 0, .c = 0, .q_m = 0, .q_l = 1, .q_r = 0, .q_o = 0, .q_c = 0 };
+    MemOp read{ .access_type = 0, .index = zero, .value = w2 };
+    BlockConstraint block{ .init = { twelve }, .trace = { read }, .type = BlockType::ROM };
+
+    AcirFormat constraint_system{
+        .varnum = 4,
+        .num_acir_opcodes = 3,
+        .public_inputs = { 1 },
+        .logic_constraints = {},
+        .range_constraints = { range },
+        .aes128_constraints = {},
+        .sha256_compression = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = {},
+        .poseidon2_constraints = {},
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = { constraint },
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = { block },
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+    constraint_system.minimal_range[0] = 32;
+
+    auto buf = constraint_systems_to_buf({ constraint_system });
+    EXPECT_TRUE(is_constraint_systems_buf(buf));
+    EXPECT_FALSE(is_constraint_systems_buf(std::span(buf).subspan(1)));
+
+    auto loaded = constraint_systems_buf_to_acir_format(buf);
+    ASSERT_EQ(loaded.size(), 1);
+    EXPECT_EQ(loaded[0], constraint_system);
+
+    WitnessVector witness{ 5, 7, 12 };
+    auto builder = create_circuit(loaded[0], /*recursive*/ false, /*size_hint*/ 0, witness);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
 TEST_F(AcirFormatTests, TestLogicGateFromNoirCircuit)
 {
     /**
@@ -450,3 +510,153 @@ TEST_F(AcirFormatTests, TestBigAdd)
 
     EXPECT_TRUE(CircuitChecker::check(builder));
 }
+
+TEST_F(AcirFormatTests, WitnessOnlyCircuit)
+{
+    // a + b = c, with a range constrained to 8 bits
+    poly_triple constraint{
+        .a = 0,
+        .b = 1,
+        .c = 2,
+        .q_m = 0,
+        .q_l = 1,
+        .q_r = 1,
+        .q_o = -1,
+        .q_c = 0,
+    };
+    RangeConstraint range_constraint{ .witness = 0, .num_bits = 8 };
+
+    AcirFormat constraint_system{
+        .varnum = 3,
+        .num_acir_opcodes = 2,
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = { range_constraint },
+        .aes128_constraints = {},
+        .sha256_compression = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = {},
+        .poseidon2_constraints = {},
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = { constraint },
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    AcirProgram program{ constraint_system, { 5, 7, 12 } };
+    auto builder = create_circuit<UltraCircuitBuilder>(program);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    AcirProgram witness_program{ constraint_system, { 5, 7, 12 } };
+    auto witness_builder = create_circuit<UltraCircuitBuilder>(witness_program, { .witness_only = true });
+    EXPECT_FALSE(witness_builder.failed());
+    EXPECT_LT(witness_builder.num_gates, builder.num_gates);
+    EXPECT_TRUE(witness_builder.range_lists.empty());
+    for (uint32_t i = 0; i < constraint_system.varnum; ++i) {
+        EXPECT_EQ(witness_builder.get_variable(i), builder.get_variable(i));
+    }
+
+    // Out of range witnesses are still caught
+    AcirProgram bad_program{ constraint_system, { 256, 7, 263 } };
+    auto bad_builder = create_circuit<UltraCircuitBuilder>(bad_program, { .witness_only = true });
+    EXPECT_TRUE(bad_builder.failed());
+}
+
+// Constructing the hash gadgets in parallel gives an equivalent circuit with the same number of gates
+TEST_F(AcirFormatTests, ParallelHashConstructionMatchesSerial)
+{
+    uint32_t next_witness = 0;
+    const auto add_witnesses = [&](auto& indices) {
+        for (auto& index : indices) {
+            index = next_witness++;
+        }
+    };
+
+    std::vector<Keccakf1600> keccak_permutations(2);
+    for (auto& keccak_permutation : keccak_permutations) {
+        for (auto& lane : keccak_permutation.state) {
+            lane = WitnessOrConstant<bb::fr>::from_index(next_witness++);
+        }
+        add_witnesses(keccak_permutation.result);
+    }
+    std::vector<Blake2sConstraint> blake2s_constraints(2);
+    for (auto& blake2s_constraint : blake2s_constraints) {
+        for (size_t i = 0; i < 4; ++i) {
+            blake2s_constraint.inputs.push_back(
+                { .blackbox_input = WitnessOrConstant<bb::fr>::from_index(next_witness++), .num_bits = 8 });
+        }
+        add_witnesses(blake2s_constraint.result);
+    }
+    Blake3Constraint blake3_constraint;
+    for (size_t i = 0; i < 4; ++i) {
+        blake3_constraint.inputs.push_back(
+            { .blackbox_input = WitnessOrConstant<bb::fr>::from_index(next_witness++), .num_bits = 8 });
+    }
+    add_witnesses(blake3_constraint.result);
+
+    AcirFormat constraint_system{
+        .varnum = next_witness,
+        .num_acir_opcodes = 5,
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .aes128_constraints = {},
+        .sha256_compression = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = blake2s_constraints,
+        .blake3_constraints = { blake3_constraint },
+        .keccak_permutations = keccak_permutations,
+        .poseidon2_constraints = {},
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    WitnessVector witness(next_witness);
+    for (size_t i = 0; i < witness.size(); ++i) {
+        witness[i] = i % 256;
+    }
+
+    AcirProgram program{ constraint_system, witness };
+    auto builder = create_circuit<UltraCircuitBuilder>(program);
+    AcirProgram parallel_program{ constraint_system, witness };
+    auto parallel_builder =
+        create_circuit<UltraCircuitBuilder>(parallel_program, { .parallel_gadget_construction = true });
+
+    EXPECT_EQ(parallel_builder.get_estimated_num_finalized_gates(), builder.get_estimated_num_finalized_gates());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    EXPECT_TRUE(CircuitChecker::check(parallel_builder));
+    // The outputs of the gadgets are the same
+    for (uint32_t i = 0; i < constraint_system.varnum; ++i) {
+        EXPECT_EQ(parallel_builder.get_variable(i), builder.get_variable(i));
+    }
+}
@@ -2,6 +2,7 @@
 #ifndef __wasm__
 #include "barretenberg/api/exec_pipe.hpp"
 #include "barretenberg/circuit_checker/circuit_checker.hpp"
+#include "barretenberg/client_ivc/mock_private_execution_steps.hpp"
 #include "barretenberg/client_ivc/private_execution_steps.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
@@ -511,6 +512,75 @@ TEST_F(AcirIntegrationTest, DISABLED_ClientIVCMsgpackInputs)
     EXPECT_TRUE(ivc->verify(proof));
 }
 
+/**
+ * @brief Test ClientIVC proof generation and verification given an ivc-inputs msgpack file, decoding the steps in a
+ * pipeline with their accumulation
+ *
+ */
+TEST_F(AcirIntegrationTest, DISABLED_ClientIVCMsgpackInputsPipelined)
+{
+    // NOTE: see DISABLED_ClientIVCMsgpackInputs to populate the test inputs at this location
+    std::string input_path = "../../../yarn-project/end-to-end/example-app-ivc-inputs-out/"
+                             "ecdsar1+transfer_0_recursions+sponsored_fpc/ivc-inputs.msgpack";
+
+    PrivateExecutionSteps steps;
+    std::shared_ptr<ClientIVC> ivc = steps.accumulate_pipelined(PrivateExecutionStepRaw::load(input_path));
+    ClientIVC::Proof proof = ivc->prove();
+
+    EXPECT_TRUE(ivc->verify(proof));
+}
+
+/**
+ * @brief Check that decoding the steps in a pipeline with their accumulation gives the same IVC as decoding them all
+ * first, and that a step that fails to decode fails the accumulation
+ *
+ */
+TEST_F(AcirIntegrationTest, ClientIVCPipelinedAccumulationMatchesSequential)
+{
+    constexpr size_t NUM_STEPS = 3;
+    const auto create_steps = []() {
+        std::vector<PrivateExecutionStepRaw> steps;
+        for (size_t i = 0; i < NUM_STEPS; i++) {
+            steps.push_back(create_mock_private_execution_step(i));
+        }
+        return steps;
+    };
+
+    PrivateExecutionSteps sequential_steps;
+    auto decompressed_steps = create_steps();
+    for (auto& step : decompressed_steps) {
+        step.decompress();
+    }
+    sequential_steps.parse(std::move(decompressed_steps));
+    std::shared_ptr<ClientIVC> sequential_ivc = sequential_steps.accumulate();
+
+    PrivateExecutionSteps pipelined_steps;
+    std::shared_ptr<ClientIVC> pipelined_ivc = pipelined_steps.accumulate_pipelined(create_steps());
+
+    EXPECT_EQ(pipelined_steps.function_names, sequential_steps.function_names);
+    ASSERT_EQ(pipelined_steps.folding_stack.size(), NUM_STEPS);
+    for (size_t i = 0; i < NUM_STEPS; i++) {
+        EXPECT_EQ(pipelined_steps.folding_stack[i].constraints, sequential_steps.folding_stack[i].constraints);
+        EXPECT_EQ(pipelined_steps.folding_stack[i].witness, sequential_steps.folding_stack[i].witness);
+    }
+    ASSERT_EQ(pipelined_ivc->verification_queue.size(), NUM_STEPS);
+    ASSERT_EQ(pipelined_ivc->verification_queue.size(), sequential_ivc->verification_queue.size());
+    for (auto [pipelined, sequential] :
+         zip_view(pipelined_ivc->verification_queue, sequential_ivc->verification_queue)) {
+        EXPECT_EQ(pipelined.type, sequential.type);
+        EXPECT_EQ(pipelined.proof, sequential.proof);
+        EXPECT_EQ(pipelined.merge_proof, sequential.merge_proof);
+        EXPECT_EQ(pipelined.honk_verification_key->hash(), sequential.honk_verification_key->hash());
+    }
+
+    // Corrupt the gzip trailer (the uncompressed size) of the witness of the second step
+    auto bad_steps = create_steps();
+    bad_steps[1].witness.back() ^= 0xff;
+    EXPECT_THROW(PrivateExecutionStepRaw(bad_steps[1]).decompress(), std::invalid_argument);
+    PrivateExecutionSteps failing_steps;
+    EXPECT_THROW(failing_steps.accumulate_pipelined(std::move(bad_steps)), std::invalid_argument);
+}
+
 /**
  * @brief Check that for a set of programs to be accumulated via CIVC, the verification keys computed with a dummy
  * witness are identical to those computed with the genuine provided witness.
@@ -6,9 +6,12 @@
 
 #include "acir_to_constraint_buf.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <set>
 #include <tuple>
 #include <utility>
 
@@ -1013,4 +1016,67 @@ AcirProgramStack get_acir_program_stack(std::string const& bytecode_path, std::s
     return { std::move(constraint_systems), std::move(witness_stack) };
 }
 
+namespace {
+// "BBCS", followed by the format version. Bump the version whenever the msgpack encoding of AcirFormat changes.
+constexpr std::array<uint8_t, 8> CONSTRAINT_SYSTEMS_HEADER = { 'B', 'B', 'C', 'S', 0, 0, 0, 1 };
+
+// Adds the fields computed while parsing that AcirFormat's own msgpack encoding leaves out
+struct SerializedConstraintSystem {
+    AcirFormat constraints;
+    uint32_t num_acir_opcodes;
+    std::set<uint32_t> constrained_witness;
+    std::map<uint32_t, uint32_t> minimal_range;
+    AcirFormatOriginalOpcodeIndices original_opcode_indices;
+
+    MSGPACK_FIELDS(constraints, num_acir_opcodes, constrained_witness, minimal_range, original_opcode_indices);
+};
+} // namespace
+
+std::vector<uint8_t> constraint_systems_to_buf(std::vector<AcirFormat> const& constraint_systems)
+{
+    std::vector<SerializedConstraintSystem> serialized;
+    serialized.reserve(constraint_systems.size());
+    for (auto const& constraint_system : constraint_systems) {
+        serialized.push_back({ constraint_system,
+                               constraint_system.num_acir_opcodes,
+                               constraint_system.constrained_witness,
+                               constraint_system.minimal_range,
+                               constraint_system.original_opcode_indices });
+    }
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, serialized);
+
+    std::vector<uint8_t> buf(CONSTRAINT_SYSTEMS_HEADER.begin(), CONSTRAINT_SYSTEMS_HEADER.end());
+    buf.insert(buf.end(), buffer.data(), buffer.data() + buffer.size());
+    return buf;
+}
+
+bool is_constraint_systems_buf(std::span<const uint8_t> buf)
+{
+    return buf.size() >= CONSTRAINT_SYSTEMS_HEADER.size() &&
+           std::equal(CONSTRAINT_SYSTEMS_HEADER.begin(), CONSTRAINT_SYSTEMS_HEADER.end(), buf.begin());
+}
+
+std::vector<AcirFormat> constraint_systems_buf_to_acir_format(std::span<const uint8_t> buf)
+{
+    if (!is_constraint_systems_buf(buf)) {
+        throw_or_abort("Not a constraint systems buffer, or one written by an incompatible version of bb.");
+    }
+    const auto data = buf.subspan(CONSTRAINT_SYSTEMS_HEADER.size());
+    msgpack::object_handle oh = msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size());
+    std::vector<SerializedConstraintSystem> serialized;
+    oh.get().convert(serialized);
+
+    std::vector<AcirFormat> constraint_systems;
+    constraint_systems.reserve(serialized.size());
+    for (auto& constraint_system : serialized) {
+        constraint_system.constraints.num_acir_opcodes = constraint_system.num_acir_opcodes;
+        constraint_system.constraints.constrained_witness = std::move(constraint_system.constrained_witness);
+        constraint_system.constraints.minimal_range = std::move(constraint_system.minimal_range);
+        constraint_system.constraints.original_opcode_indices = std::move(constraint_system.original_opcode_indices);
+        constraint_systems.emplace_back(std::move(constraint_system.constraints));
+    }
+    return constraint_systems;
+}
+
 } // namespace acir_format
@@ -8,6 +8,8 @@
 #include "acir_format.hpp"
 #include "serde/index.hpp"
 
+#include <span>
+
 namespace acir_format {
 
 /**
@@ -27,4 +29,22 @@ std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t>&& buf);
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t>&& buf);
 
 AcirProgramStack get_acir_program_stack(std::string const& bytecode_path, std::string const& witness_path);
+
+/**
+ * @brief Serializes constraint systems (e.g. those of a program parsed with `program_buf_to_acir_format`) into
+ * Barretenberg's own binary format: a magic number and version, followed by the msgpack encoding of the constraint
+ * systems. Loading it skips decompressing and parsing the ACIR bytecode, and converting it to `AcirFormat`.
+ */
+std::vector<uint8_t> constraint_systems_to_buf(std::vector<AcirFormat> const& constraint_systems);
+
+/**
+ * @brief Whether `buf` starts like the output of `constraint_systems_to_buf` (ACIR bytecode is gzipped or JSON).
+ */
+bool is_constraint_systems_buf(std::span<const uint8_t> buf);
+
+/**
+ * @brief Deserializes the output of `constraint_systems_to_buf`. The buffer is read in place, so it can be a memory
+ * mapped file.
+ */
+std::vector<AcirFormat> constraint_systems_buf_to_acir_format(std::span<const uint8_t> buf);
 } // namespace acir_format
@@ -5,6 +5,7 @@
 // =====================
 
 #pragma once
+#include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include <cstdint>
 #include <vector>
@@ -15,6 +16,8 @@ struct MemOp {
     uint8_t access_type;
     bb::poly_triple index;
     bb::poly_triple value;
+
+    MSGPACK_FIELDS(access_type, index, value);
 };
 
 enum BlockType {
@@ -29,6 +32,8 @@ struct BlockConstraint {
     std::vector<MemOp> trace;
     BlockType type;
     uint32_t calldata_id{ 0 };
+
+    MSGPACK_FIELDS(init, trace, type, calldata_id);
 };
 
 template <typename Builder>
@@ -88,3 +93,5 @@ template <typename B> inline void write(B& buf, BlockConstraint const& constrain
     write(buf, static_cast<uint8_t>(constraint.type));
 }
 } // namespace acir_format
+
+MSGPACK_ADD_ENUM(acir_format::BlockType)
@@ -129,6 +129,57 @@ TEST_F(ECDSASecp256k1, TestECDSAConstraintSucceed)
     EXPECT_TRUE(CircuitChecker::check(builder));
 }
 
+// ECDSA uses ROM tables, so it is constructed in the builder itself even with parallel gadget construction
+TEST_F(ECDSASecp256k1, TestECDSAParallelGadgetConstruction)
+{
+    EcdsaSecp256k1Constraint ecdsa_k1_constraint;
+    WitnessVector witness_values;
+    size_t num_variables = generate_ecdsa_constraint(ecdsa_k1_constraint, witness_values);
+    AcirFormat constraint_system{
+        .varnum = static_cast<uint32_t>(num_variables),
+        .num_acir_opcodes = 1,
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .aes128_constraints = {},
+        .sha256_compression = {},
+
+        .ecdsa_k1_constraints = { ecdsa_k1_constraint },
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = {},
+        .poseidon2_constraints = {},
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    AcirProgram program{ constraint_system, witness_values };
+    auto builder = create_circuit<Builder>(program);
+    AcirProgram parallel_program{ constraint_system, witness_values };
+    auto parallel_builder = create_circuit<Builder>(parallel_program, { .parallel_gadget_construction = true });
+
+    EXPECT_EQ(parallel_builder.get_variable(ecdsa_k1_constraint.result), 1);
+    EXPECT_FALSE(parallel_builder.rom_arrays.empty());
+    EXPECT_EQ(parallel_builder.rom_arrays.size(), builder.rom_arrays.size());
+    EXPECT_EQ(parallel_builder.get_estimated_num_finalized_gates(), builder.get_estimated_num_finalized_gates());
+    EXPECT_TRUE(CircuitChecker::check(parallel_builder));
+}
+
 // Test that the verifier can create an ECDSA circuit.
 // The ECDSA circuit requires that certain dummy data is valid
 // even though we are just building the circuit.
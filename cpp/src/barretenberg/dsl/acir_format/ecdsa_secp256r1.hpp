@@ -6,6 +6,7 @@
 
 #pragma once
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <array>
 #include <cstdint>
 #include <vector>
@@ -31,6 +32,8 @@ struct EcdsaSecp256r1Constraint {
     //
     std::array<uint32_t, 64> signature;
 
+    // for serialization, update with any new fields
+    MSGPACK_FIELDS(hashed_message, pub_x_indices, pub_y_indices, result, signature);
     friend bool operator==(EcdsaSecp256r1Constraint const& lhs, EcdsaSecp256r1Constraint const& rhs) = default;
 };
 
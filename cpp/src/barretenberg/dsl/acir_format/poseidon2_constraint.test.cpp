@@ -86,4 +86,91 @@ TEST_F(Poseidon2Tests, TestPoseidon2Permutation)
     EXPECT_TRUE(CircuitChecker::check(builder));
 }
 
+/**
+ * @brief Repeating a permutation of the same state only adds gates once with gate deduplication
+ *
+ */
+TEST_F(Poseidon2Tests, TestPoseidon2PermutationDeduplication)
+{
+    Poseidon2Constraint
+        poseidon2_constraint{
+            .state = {
+                WitnessOrConstant<bb::fr>::from_index(1),
+                WitnessOrConstant<bb::fr>::from_index(2),
+                WitnessOrConstant<bb::fr>::from_index(3),
+                WitnessOrConstant<bb::fr>::from_index(4),
+ },
+            .result = { 5, 6, 7, 8, },
+            .len = 4,
+        };
+
+    AcirFormat constraint_system{
+        .varnum = 9,
+        .num_acir_opcodes = 3,
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .aes128_constraints = {},
+        .sha256_compression = {},
+
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = {},
+        .poseidon2_constraints = { poseidon2_constraint, poseidon2_constraint, poseidon2_constraint },
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    WitnessVector witness{
+        1,
+        0,
+        1,
+        2,
+        3,
+        fr(std::string("0x01bd538c2ee014ed5141b29e9ae240bf8db3fe5b9a38629a9647cf8d76c01737")),
+        fr(std::string("0x239b62e7db98aa3a2a8f6a0d2fa1709e7a35959aa6c7034814d9daa90cbac662")),
+        fr(std::string("0x04cbb44c61d928ed06808456bf758cbf0c18d1e15a7b6dbc8245fa7515d5e3cb")),
+        fr(std::string("0x2e11c5cff2a22c64d01304b778d78f6998eff1ab73163a35603f54794c30847a")),
+    };
+
+    AcirProgram program{ constraint_system, witness };
+    auto builder =
+        create_circuit(program, ProgramMetadata{ .collect_gates_per_opcode = true, .deduplicate_gates = true });
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // The repeated permutations, and the gates equating their output to the result witnesses, are all duplicates
+    const auto& gates_per_opcode = program.constraints.gates_per_opcode;
+    const auto& deduplicated_gates_per_opcode = program.constraints.deduplicated_gates_per_opcode;
+    ASSERT_EQ(deduplicated_gates_per_opcode.size(), 3UL);
+    EXPECT_EQ(deduplicated_gates_per_opcode[0], 0UL);
+    EXPECT_GT(deduplicated_gates_per_opcode[1], 0UL);
+    EXPECT_EQ(deduplicated_gates_per_opcode[2], deduplicated_gates_per_opcode[1]);
+    EXPECT_EQ(gates_per_opcode[1], 0UL);
+    EXPECT_EQ(gates_per_opcode[2], 0UL);
+    EXPECT_EQ(builder.num_deduplicated_gates, 2 * deduplicated_gates_per_opcode[1]);
+
+    // With a single permutation, the circuit has the same gates
+    constraint_system.num_acir_opcodes = 1;
+    constraint_system.poseidon2_constraints.resize(1);
+    constraint_system.original_opcode_indices.poseidon2_constraints.resize(1);
+    auto single_builder = create_circuit(constraint_system, /*recursive*/ false, /*size_hint=*/0, witness);
+    EXPECT_EQ(builder.num_gates, single_builder.num_gates);
+}
+
 } // namespace acir_format::tests
@@ -6,6 +6,7 @@
 
 #pragma once
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <cstdint>
 #include <vector>
 
@@ -63,6 +64,7 @@ struct RecursionConstraint {
     uint32_t key_hash;
     uint32_t proof_type;
 
+    MSGPACK_FIELDS(key, proof, public_inputs, key_hash, proof_type);
     friend bool operator==(RecursionConstraint const& lhs, RecursionConstraint const& rhs) = default;
 };
 
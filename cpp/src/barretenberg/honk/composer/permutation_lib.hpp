@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -33,7 +34,7 @@ namespace bb {
 
 /**
  * @brief cycle_node represents the idx of a value of the circuit.
- * It will belong to a CyclicPermutation, such that all nodes in a CyclicPermutation
+ * It will belong to a copy cycle (see CopyCycles), such that all nodes in a cycle
  * must have the value.
  * The total number of constraints is always <2^32 since that is the type used to represent variables, so we can save
  * space by using a type smaller than size_t.
@@ -124,7 +125,20 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, i.e. for each variable the wire addresses that hold it, stored as one flat
+ * compressed sparse row array: the nodes of cycle i are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1].
+ */
+struct CopyCycles {
+    std::vector<size_t> offsets; // num cycles + 1 entries
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    std::span<const cycle_node> operator[](size_t cycle_idx) const
+    {
+        return { nodes.data() + offsets[cycle_idx], offsets[cycle_idx + 1] - offsets[cycle_idx] };
+    }
+};
 
 namespace {
 /**
@@ -143,7 +157,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -154,7 +168,7 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
 
     // Go through each cycle
     for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
+        const std::span<const cycle_node> cycle = wire_copy_cycles[cycle_idx];
         for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
             // Get the indices (column, row) of the current node in the cycle
             const cycle_node& current_node = cycle[node_idx];
@@ -248,7 +262,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
                 if (current_is_public_input) {
                     // We intentionally want to break the cycles of the public input variables.
                     // During the witness generation, the left and right wire polynomials at idx i contain the i-th
-                    // public input. The CyclicPermutation created for these variables always start with (i) -> (n+i),
+                    // public input. The copy cycle created for these variables always start with (i) -> (n+i),
                     // followed by the indices of the variables in the "real" gates. We make i point to
                     // -(i+1), so that the only way of repairing the cycle is add the mapping
                     //  -(i+1) -> (n+i)
@@ -282,7 +296,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraOrMegaHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
@@ -7,6 +7,7 @@
 #pragma once
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
 #include <cstdint>
 
 // TODO(#557): The field-specific aliases for gates should be removed and the type could be explicit when this
@@ -45,6 +46,8 @@ template <typename FF> struct mul_quad_ {
     FF c_scaling;
     FF d_scaling;
     FF const_scaling;
+
+    MSGPACK_FIELDS(a, b, c, d, mul_scaling, a_scaling, b_scaling, c_scaling, d_scaling, const_scaling);
 };
 template <typename FF> struct mul_triple_ {
     uint32_t a;
@@ -64,6 +67,7 @@ template <typename FF> struct poly_triple_ {
     FF q_o;
     FF q_c;
 
+    MSGPACK_FIELDS(a, b, c, q_m, q_l, q_r, q_o, q_c);
     friend bool operator==(poly_triple_<FF> const& lhs, poly_triple_<FF> const& rhs) = default;
 };
 using poly_triple = poly_triple_<bb::fr>;
@@ -99,8 +99,21 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
     Polynomial numerator{ active_domain_size };
     Polynomial denominator{ active_domain_size };
 
-    // Step (1)
-    // Populate `numerator` and `denominator` with the algebra described by Relation
+    // Steps (1) and (2) are fused into two passes over the active rows, each fully parallel:
+    // (i)   each thread populates its share of `numerator` and `denominator` with the algebra described by Relation
+    //       and, while the values are hot, accumulates them into running products ∏ A(j), ∏ B(j) local to its share
+    // (ii)  an exclusive scan over the per-thread subproducts gives the factor converting each thread's local running
+    //       products into the global ones
+    // (iii) each thread applies its factor, inverts its share of the denominator and writes its share of Z_perm
+    //
+    // For example, consider 4 threads and a size-8 numerator { a0, a1, a2, a3, a4, a5, a6, a7 }
+    // (i)   Each thread computes 1 element of N = {{ a0, a0a1 }, { a2, a2a3 }, { a4, a4a5 }, { a6, a6a7 }}
+    // (ii)  Take partial products P = { 1, a0a1, a0a1a2a3, a0a1a2a3a4a5 }
+    // (iii) Each thread j computes N[i][j]*P[j]=
+    //      {{a0,a0a1},{a0a1a2,a0a1a2a3},{a0a1a2a3a4,a0a1a2a3a4a5},{a0a1a2a3a4a5a6,a0a1a2a3a4a5a6a7}}
+    std::vector<FF> partial_numerators(active_range_thread_data.num_threads);
+    std::vector<FF> partial_denominators(active_range_thread_data.num_threads);
+
     parallel_for(active_range_thread_data.num_threads, [&](size_t thread_idx) {
         const size_t start = active_range_thread_data.start[thread_idx];
         const size_t end = active_range_thread_data.end[thread_idx];
@@ -113,37 +126,16 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
             } else {
                 row = full_polynomials.get_row(row_idx);
             }
-            numerator.at(i) =
+            FF numerator_term =
                 GrandProdRelation::template compute_grand_product_numerator<Accumulator>(row, relation_parameters);
-            denominator.at(i) =
+            FF denominator_term =
                 GrandProdRelation::template compute_grand_product_denominator<Accumulator>(row, relation_parameters);
-        }
-    });
-
-    DEBUG_LOG_ALL(numerator.coeffs());
-    DEBUG_LOG_ALL(denominator.coeffs());
-
-    // Step (2)
-    // Compute the accumulating product of the numerator and denominator terms.
-    // This step is split into three parts for efficient multithreading:
-    // (i) compute ∏ A(j), ∏ B(j) subproducts for each thread
-    // (ii) compute scaling factor required to convert each subproduct into a single running product
-    // (ii) combine subproducts into a single running product
-    //
-    // For example, consider 4 threads and a size-8 numerator { a0, a1, a2, a3, a4, a5, a6, a7 }
-    // (i)   Each thread computes 1 element of N = {{ a0, a0a1 }, { a2, a2a3 }, { a4, a4a5 }, { a6, a6a7 }}
-    // (ii)  Take partial products P = { 1, a0a1, a2a3, a4a5 }
-    // (iii) Each thread j computes N[i][j]*P[j]=
-    //      {{a0,a0a1},{a0a1a2,a0a1a2a3},{a0a1a2a3a4,a0a1a2a3a4a5},{a0a1a2a3a4a5a6,a0a1a2a3a4a5a6a7}}
-    std::vector<FF> partial_numerators(active_range_thread_data.num_threads);
-    std::vector<FF> partial_denominators(active_range_thread_data.num_threads);
-
-    parallel_for(active_range_thread_data.num_threads, [&](size_t thread_idx) {
-        const size_t start = active_range_thread_data.start[thread_idx];
-        const size_t end = active_range_thread_data.end[thread_idx];
-        for (size_t i = start; i < end - 1; ++i) {
-            numerator.at(i + 1) *= numerator[i];
-            denominator.at(i + 1) *= denominator[i];
+            if (i > start) {
+                numerator_term *= numerator[i - 1];
+                denominator_term *= denominator[i - 1];
+            }
+            numerator.at(i) = numerator_term;
+            denominator.at(i) = denominator_term;
         }
         partial_numerators[thread_idx] = numerator[end - 1];
         partial_denominators[thread_idx] = denominator[end - 1];
@@ -152,29 +144,13 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
     DEBUG_LOG_ALL(partial_numerators);
     DEBUG_LOG_ALL(partial_denominators);
 
-    parallel_for(active_range_thread_data.num_threads, [&](size_t thread_idx) {
-        const size_t start = active_range_thread_data.start[thread_idx];
-        const size_t end = active_range_thread_data.end[thread_idx];
-        if (thread_idx > 0) {
-            FF numerator_scaling = 1;
-            FF denominator_scaling = 1;
-
-            for (size_t j = 0; j < thread_idx; ++j) {
-                numerator_scaling *= partial_numerators[j];
-                denominator_scaling *= partial_denominators[j];
-            }
-            for (size_t i = start; i < end; ++i) {
-                numerator.at(i) = numerator[i] * numerator_scaling;
-                denominator.at(i) = denominator[i] * denominator_scaling;
-            }
-        }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator.data()[start], end - start });
-    });
-
-    DEBUG_LOG_ALL(numerator.coeffs());
-    DEBUG_LOG_ALL(denominator.coeffs());
+    // Exclusive scan: the scaling factor of each thread is the product of the subproducts of all preceding threads
+    std::vector<FF> numerator_scalings(active_range_thread_data.num_threads, FF(1));
+    std::vector<FF> denominator_scalings(active_range_thread_data.num_threads, FF(1));
+    for (size_t thread_idx = 1; thread_idx < active_range_thread_data.num_threads; ++thread_idx) {
+        numerator_scalings[thread_idx] = numerator_scalings[thread_idx - 1] * partial_numerators[thread_idx - 1];
+        denominator_scalings[thread_idx] = denominator_scalings[thread_idx - 1] * partial_denominators[thread_idx - 1];
+    }
 
     // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
     auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
@@ -190,33 +166,44 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
     parallel_for(active_range_thread_data.num_threads, [&](size_t thread_idx) {
         const size_t start = active_range_thread_data.start[thread_idx];
         const size_t end = active_range_thread_data.end[thread_idx];
+        if (thread_idx > 0) {
+            for (size_t i = start; i < end; ++i) {
+                numerator.at(i) *= numerator_scalings[thread_idx];
+                denominator.at(i) *= denominator_scalings[thread_idx];
+            }
+        }
+        FF::batch_invert(std::span{ &denominator.data()[start], end - start });
         for (size_t i = start; i < end; ++i) {
             const auto poly_idx = get_active_range_poly_idx(i + 1);
             grand_product_polynomial.at(poly_idx) = numerator[i] * denominator[i];
         }
     });
 
+    DEBUG_LOG_ALL(numerator.coeffs());
+    DEBUG_LOG_ALL(denominator.coeffs());
+
     // Final step: If active/inactive regions have been specified, the value of the grand product in the inactive
     // regions have not yet been set. The polynomial takes an already computed constant value across each inactive
     // region (since no copy constraints are present there) equal to the value of the grand product at the first index
-    // of the subsequent active region.
+    // of the subsequent active region. Only the inactive regions are visited.
     if (has_active_ranges) {
-        MultithreadData full_domain_thread_data = calculate_thread_data(domain_size);
-        parallel_for(full_domain_thread_data.num_threads, [&](size_t thread_idx) {
-            const size_t start = full_domain_thread_data.start[thread_idx];
-            const size_t end = full_domain_thread_data.end[thread_idx];
-            for (size_t i = start; i < end; ++i) {
-                for (size_t j = 0; j < active_region_data.num_ranges() - 1; ++j) {
-                    const size_t previous_range_end = active_region_data.get_range(j).second;
-                    const size_t next_range_start = active_region_data.get_range(j + 1).first;
-                    // Set the value of the polynomial if the index falls in an inactive region
-                    if (i >= previous_range_end && i < next_range_start) {
-                        grand_product_polynomial.at(i) = grand_product_polynomial[next_range_start];
-                        break;
-                    }
-                }
+        for (size_t j = 0; j + 1 < active_region_data.num_ranges(); ++j) {
+            const size_t previous_range_end = active_region_data.get_range(j).second;
+            const size_t next_range_start = active_region_data.get_range(j + 1).first;
+            const size_t inactive_end = std::min(next_range_start, domain_size);
+            if (previous_range_end >= inactive_end) {
+                continue;
             }
-        });
+            const FF value = grand_product_polynomial[next_range_start];
+            parallel_for_heuristic(
+                inactive_end - previous_range_end,
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    for (size_t i = previous_range_end + start; i < previous_range_end + end; ++i) {
+                        grand_product_polynomial.at(i) = value;
+                    }
+                },
+                thread_heuristics::FF_COPY_COST);
+        }
     }
 
     DEBUG_LOG_ALL(grand_product_polynomial.coeffs());
@@ -57,8 +57,77 @@ void LMDBEnvironment::release_writer()
     _writeGuard.release();
 }
 
+MDB_txn* LMDBEnvironment::acquire_read_transaction()
+{
+    MDB_txn* tx = nullptr;
+    {
+        std::unique_lock lock(_readTransactionPoolLock);
+        if (_readTransactionPool.empty()) {
+            ++_numReadTransactions;
+        } else {
+            tx = _readTransactionPool.back();
+            _readTransactionPool.pop_back();
+        }
+    }
+    if (tx != nullptr) {
+        if (mdb_txn_renew(tx) == 0) {
+            ++_renewedTransactions;
+            return tx;
+        }
+        // The handle could not be renewed, discard it and begin a new transaction in its place
+        call_lmdb_func(mdb_txn_abort, tx);
+        tx = nullptr;
+    }
+    try {
+        MDB_txn* parent = nullptr;
+        call_lmdb_func("mdb_txn_begin", mdb_txn_begin, _mdbEnv, parent, static_cast<unsigned int>(MDB_RDONLY), &tx);
+    } catch (std::runtime_error&) {
+        std::unique_lock lock(_readTransactionPoolLock);
+        --_numReadTransactions;
+        throw;
+    }
+    ++_createdTransactions;
+    return tx;
+}
+
+void LMDBEnvironment::release_read_transaction(MDB_txn* tx)
+{
+    call_lmdb_func(mdb_txn_reset, tx);
+    std::unique_lock lock(_readTransactionPoolLock);
+    _readTransactionPool.push_back(tx);
+}
+
+void LMDBEnvironment::reserve_reader_slot()
+{
+    std::unique_lock lock(_readTransactionPoolLock);
+    // The caller holds a reader slot, so if every reader table entry is taken at least one of them is pooled
+    if (_numReadTransactions >= _readGuard._maxAllowed && !_readTransactionPool.empty()) {
+        call_lmdb_func(mdb_txn_abort, _readTransactionPool.back());
+        _readTransactionPool.pop_back();
+        --_numReadTransactions;
+    }
+}
+
+LMDBEnvironment::ReaderMetrics LMDBEnvironment::get_reader_metrics()
+{
+    ReaderMetrics metrics;
+    {
+        std::unique_lock lock(_readGuard._lock);
+        metrics.acquisitions = _readGuard._acquisitions;
+        metrics.waits = _readGuard._waits;
+        metrics.totalWaitNs = _readGuard._totalWaitNs;
+    }
+    metrics.renewedTransactions = _renewedTransactions;
+    metrics.createdTransactions = _createdTransactions;
+    return metrics;
+}
+
 LMDBEnvironment::~LMDBEnvironment()
 {
+    // Any read transactions still in use hold a reference to the environment, so only pooled handles remain
+    for (MDB_txn* tx : _readTransactionPool) {
+        call_lmdb_func(mdb_txn_abort, tx);
+    }
     call_lmdb_func(mdb_env_close, _mdbEnv);
 }
 
@@ -74,6 +143,28 @@ uint64_t LMDBEnvironment::get_map_size() const
     return info.me_mapsize;
 }
 
+void LMDBEnvironment::set_deferred_sync(bool enabled)
+{
+    call_lmdb_func(
+        "mdb_env_set_flags", mdb_env_set_flags, _mdbEnv, static_cast<unsigned int>(MDB_NOSYNC), enabled ? 1 : 0);
+}
+
+void LMDBEnvironment::sync()
+{
+    call_lmdb_func("mdb_env_sync", mdb_env_sync, _mdbEnv, 1);
+    ++_syncs;
+}
+
+LMDBEnvironment::SyncMetrics LMDBEnvironment::get_sync_metrics() const
+{
+    unsigned int flags = 0;
+    call_lmdb_func("mdb_env_get_flags", mdb_env_get_flags, _mdbEnv, &flags);
+    SyncMetrics metrics;
+    metrics.deferred = (flags & MDB_NOSYNC) != 0;
+    metrics.syncs = _syncs;
+    return metrics;
+}
+
 uint64_t LMDBEnvironment::get_data_file_size() const
 {
     std::string dataPath = (std::filesystem::path(_directory) / "data.mdb").string();
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <lmdb.h>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 namespace bb::lmdblib {
 
 /*
@@ -36,6 +38,9 @@ class LMDBEnvironment {
 
     MDB_env* underlying() const;
 
+    /**
+     * @brief Acquires one of the reader slots, blocking until one is available
+     */
     void wait_for_reader();
 
     void release_reader();
@@ -50,6 +55,58 @@ class LMDBEnvironment {
 
     uint64_t get_data_file_size() const;
 
+    /**
+     * @brief Toggles MDB_NOSYNC on the environment. While enabled, committed write transactions are not flushed to
+     * disk until sync() is called, allowing several commits to share a single flush.
+     */
+    void set_deferred_sync(bool enabled);
+
+    /**
+     * @brief Forces a synchronous flush of all committed data to disk
+     */
+    void sync();
+
+    struct SyncMetrics {
+        // Whether MDB_NOSYNC is set, i.e. write transactions are committed without flushing
+        bool deferred = false;
+        // Number of explicit flushes via sync()
+        uint64_t syncs = 0;
+    };
+
+    SyncMetrics get_sync_metrics() const;
+
+    /**
+     * @brief Returns an active read transaction handle. Handles previously returned via release_read_transaction are
+     * renewed (mdb_txn_renew) in preference to beginning a new transaction. The caller must hold a reader slot.
+     */
+    MDB_txn* acquire_read_transaction();
+
+    /**
+     * @brief Resets (mdb_txn_reset) a read transaction obtained from acquire_read_transaction and returns the handle to
+     * the pool. The handle must not be used by the caller afterwards.
+     */
+    void release_read_transaction(MDB_txn* tx);
+
+    /**
+     * @brief Pooled read transaction handles keep their LMDB reader table entry. This frees an entry if required so
+     * that a read transaction created outside of the pool (e.g. by mdb_env_copy2) can begin. The caller must hold a
+     * reader slot.
+     */
+    void reserve_reader_slot();
+
+    struct ReaderMetrics {
+        // Number of reader slots acquired
+        uint64_t acquisitions = 0;
+        // Number of acquisitions that blocked because all reader slots were in use
+        uint64_t waits = 0;
+        uint64_t totalWaitNs = 0;
+        // Read transactions served from the pool versus newly begun
+        uint64_t renewedTransactions = 0;
+        uint64_t createdTransactions = 0;
+    };
+
+    ReaderMetrics get_reader_metrics();
+
   private:
     std::atomic_uint64_t _id;
     std::string _directory;
@@ -66,11 +123,21 @@ class LMDBEnvironment {
             , _current(0)
         {}
 
+        uint64_t _acquisitions = 0;
+        uint64_t _waits = 0;
+        uint64_t _totalWaitNs = 0;
+
         void wait()
         {
             std::unique_lock lock(_lock);
+            ++_acquisitions;
             if (_current >= _maxAllowed) {
+                auto start = std::chrono::steady_clock::now();
                 _condition.wait(lock, [&] { return _current < _maxAllowed; });
+                ++_waits;
+                _totalWaitNs += static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                        .count());
             }
             ++_current;
         }
@@ -84,5 +151,14 @@ class LMDBEnvironment {
     };
     ResourceGuard _readGuard;
     ResourceGuard _writeGuard;
+
+    // Reset read transaction handles available for renewal
+    std::mutex _readTransactionPoolLock;
+    std::vector<MDB_txn*> _readTransactionPool;
+    // The number of read transaction handles in existence, both pooled and in use
+    uint32_t _numReadTransactions = 0;
+    std::atomic_uint64_t _renewedTransactions{ 0 };
+    std::atomic_uint64_t _createdTransactions{ 0 };
+    std::atomic_uint64_t _syncs{ 0 };
 };
 } // namespace bb::lmdblib
@@ -210,3 +210,43 @@ TEST_F(LMDBEnvironmentTest, can_read_multiple_threads)
         }
     }
 }
+
+TEST_F(LMDBEnvironmentTest, read_transactions_are_renewed_from_pool)
+{
+    LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
+        LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, LMDBEnvironmentTest::_maxReaders);
+
+    LMDBDatabase::SharedPtr db;
+    {
+        environment->wait_for_writer();
+        LMDBDatabaseCreationTransaction tx(environment);
+        db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+        EXPECT_NO_THROW(tx.commit());
+    }
+
+    int64_t numValues = 10;
+    for (int64_t count = 0; count < numValues; count++) {
+        {
+            environment->wait_for_writer();
+            LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+            auto key = get_key(count);
+            auto data = get_value(count, 0);
+            EXPECT_NO_THROW(tx->put_value(key, data, *db));
+            EXPECT_NO_THROW(tx->commit());
+        }
+        // A renewed transaction must observe the latest commit
+        environment->wait_for_reader();
+        LMDBReadTransaction::Ptr tx = std::make_unique<LMDBReadTransaction>(environment);
+        auto key = get_key(count);
+        auto expected = get_value(count, 0);
+        std::vector<uint8_t> data;
+        EXPECT_TRUE(tx->get_value(key, data, *db));
+        EXPECT_EQ(data, expected);
+    }
+
+    LMDBEnvironment::ReaderMetrics metrics = environment->get_reader_metrics();
+    EXPECT_EQ(metrics.acquisitions, static_cast<uint64_t>(numValues));
+    EXPECT_EQ(metrics.waits, 0);
+    EXPECT_EQ(metrics.createdTransactions, 1);
+    EXPECT_EQ(metrics.renewedTransactions, static_cast<uint64_t>(numValues - 1));
+}
@@ -1,4 +1,5 @@
 #include "barretenberg/lmdblib/lmdb_store_base.hpp"
+#include <exception>
 
 namespace bb::lmdblib {
 LMDBStoreBase::LMDBStoreBase(std::string directory, uint64_t mapSizeKb, uint64_t maxNumReaders, uint64_t maxDbs)
@@ -36,11 +37,56 @@ void LMDBStoreBase::copy_store(const std::string& dstPath, bool compact)
     // "[mdb_copy] can trigger significant file size growth if run in parallel with write transactions,
     //  because pages which they free during copying cannot be reused until the copy is done."
     WriteTransaction::Ptr tx = create_write_transaction();
-    call_lmdb_func("mdb_env_copy2",
-                   mdb_env_copy2,
-                   _environment->underlying(),
-                   dstPath.c_str(),
-                   static_cast<unsigned int>(compact ? MDB_CP_COMPACT : 0));
+    copy_store_snapshot(dstPath, compact);
+}
+
+void LMDBStoreBase::copy_store_snapshot(const std::string& dstPath, bool compact)
+{
+    // mdb_env_copy2 performs the copy within its own read transaction, so we only need to hold a reader slot and
+    // ensure that LMDB has a reader table entry available for it
+    _environment->wait_for_reader();
+    _environment->reserve_reader_slot();
+    try {
+        call_lmdb_func("mdb_env_copy2",
+                       mdb_env_copy2,
+                       _environment->underlying(),
+                       dstPath.c_str(),
+                       static_cast<unsigned int>(compact ? MDB_CP_COMPACT : 0));
+    } catch (std::exception&) {
+        _environment->release_reader();
+        throw;
+    }
+    _environment->release_reader();
+}
+
+uint64_t LMDBStoreBase::get_map_size() const
+{
+    return _environment->get_map_size();
+}
+
+uint64_t LMDBStoreBase::get_data_file_size() const
+{
+    return _environment->get_data_file_size();
+}
+
+LMDBEnvironment::ReaderMetrics LMDBStoreBase::get_reader_metrics() const
+{
+    return _environment->get_reader_metrics();
+}
+
+void LMDBStoreBase::set_deferred_sync(bool enabled)
+{
+    _environment->set_deferred_sync(enabled);
+}
+
+void LMDBStoreBase::sync()
+{
+    _environment->sync();
+}
+
+LMDBEnvironment::SyncMetrics LMDBStoreBase::get_sync_metrics() const
+{
+    return _environment->get_sync_metrics();
 }
 
 } // namespace bb::lmdblib
\ No newline at end of file
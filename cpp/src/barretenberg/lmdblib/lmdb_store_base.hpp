@@ -22,6 +22,17 @@ class LMDBStoreBase {
     WriteTransaction::Ptr create_write_transaction() const;
     LMDBDatabaseCreationTransaction::Ptr create_db_transaction() const;
     void copy_store(const std::string& dstPath, bool compact);
+    /**
+     * @brief Copies the store from a read snapshot without blocking writers. Data committed after the snapshot was
+     * taken is not included in the copy.
+     */
+    void copy_store_snapshot(const std::string& dstPath, bool compact);
+    uint64_t get_map_size() const;
+    uint64_t get_data_file_size() const;
+    LMDBEnvironment::ReaderMetrics get_reader_metrics() const;
+    void set_deferred_sync(bool enabled);
+    void sync();
+    LMDBEnvironment::SyncMetrics get_sync_metrics() const;
 
   protected:
     std::string _dbDirectory;
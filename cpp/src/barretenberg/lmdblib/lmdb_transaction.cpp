@@ -9,10 +9,16 @@ LMDBTransaction::LMDBTransaction(std::shared_ptr<LMDBEnvironment> env, bool read
     : _environment(std::move(env))
     , _id(_environment->getNextId())
     , state(TransactionState::OPEN)
+    , _readOnly(readOnly)
 {
+    if (_readOnly) {
+        // Read transactions are reset and renewed rather than created and destroyed for every query
+        _transaction = _environment->acquire_read_transaction();
+        return;
+    }
     MDB_txn* p = nullptr;
     const std::string name("mdb_txn_begin");
-    call_lmdb_func(name, mdb_txn_begin, _environment->underlying(), p, readOnly ? MDB_RDONLY : 0U, &_transaction);
+    call_lmdb_func(name, mdb_txn_begin, _environment->underlying(), p, 0U, &_transaction);
 }
 
 LMDBTransaction::~LMDBTransaction() = default;
@@ -32,7 +38,11 @@ void LMDBTransaction::abort()
     if (state != TransactionState::OPEN) {
         return;
     }
-    call_lmdb_func(mdb_txn_abort, _transaction);
+    if (_readOnly) {
+        _environment->release_read_transaction(_transaction);
+    } else {
+        call_lmdb_func(mdb_txn_abort, _transaction);
+    }
     state = TransactionState::ABORTED;
 }
 
@@ -45,4 +55,8 @@ bool LMDBTransaction::get_value(std::vector<uint8_t>& key, uint64_t& data, const
 {
     return lmdb_queries::get_value(key, data, db, *this);
 }
+bool LMDBTransaction::get_value_view(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    return lmdb_queries::get_value_view(key, data, db, *this);
+}
 } // namespace bb::lmdblib
\ No newline at end of file
@@ -56,6 +56,13 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Retrieves the value stored against the key without copying it out of the database.
+     * The returned view points directly into the memory mapped pages of the environment and is only valid until the
+     * transaction ends or, for write transactions, until the next modification made within it.
+     */
+    template <typename T> bool get_value_view(T& key, MDB_val& data, const LMDBDatabase& db) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -70,11 +77,14 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    bool get_value_view(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
     MDB_txn* _transaction;
     TransactionState state;
+    bool _readOnly;
 };
 
 template <typename T> bool LMDBTransaction::get_value(T& key, std::vector<uint8_t>& data, const LMDBDatabase& db) const
@@ -89,6 +99,12 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T> bool LMDBTransaction::get_value_view(T& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value_view(keyBuffer, data, db);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
@@ -450,6 +450,8 @@ bool get_value(Key& key, Value& data, const LMDBDatabase& db, const LMDBTransact
 
 bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 
+bool get_value_view(Key& key, MDB_val& data, const LMDBDatabase& db, const LMDBTransaction& tx);
+
 bool set_at_key(const LMDBCursor& cursor, Key& key);
 bool set_at_key_gte(const LMDBCursor& cursor, Key& key);
 bool set_at_start(const LMDBCursor& cursor);
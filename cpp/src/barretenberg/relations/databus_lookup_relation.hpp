@@ -211,6 +211,39 @@ template <typename FF_> class DatabusLookupRelationImpl {
         return Accumulator((w_2 * beta) + w_1 + gamma);
     }
 
+    /**
+     * @brief Compute the value of the polynomial I at row i before inversion, i.e. read_term_i*write_term_i, or zero if
+     * the row contains neither a read gate for the given bus column nor data of that column that has been read.
+     */
+    template <size_t bus_idx, typename Polynomials>
+    static FF compute_inverse_denominator(const Polynomials& polynomials, const auto& relation_parameters, size_t i)
+    {
+        bool is_read = false;
+        bool nonzero_read_count = false;
+        // Determine if the present row contains a databus operation
+        auto q_busread = polynomials.q_busread[i];
+        if constexpr (bus_idx == 0) { // calldata
+            is_read = q_busread == 1 && polynomials.q_l[i] == 1;
+            nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
+        }
+        if constexpr (bus_idx == 1) { // secondary_calldata
+            is_read = q_busread == 1 && polynomials.q_r[i] == 1;
+            nonzero_read_count = polynomials.secondary_calldata_read_counts[i] > 0;
+        }
+        if constexpr (bus_idx == 2) { // return data
+            is_read = q_busread == 1 && polynomials.q_o[i] == 1;
+            nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
+        }
+        // We only compute the inverse if this row contains a read gate or data that has been read
+        if (!is_read && !nonzero_read_count) {
+            return FF(0);
+        }
+        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+        auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
+        return compute_read_term<FF>(row, relation_parameters) *
+               compute_write_term<FF, bus_idx>(row, relation_parameters);
+    }
+
     /**
      * @brief Construct the polynomial I whose components are the inverse of the product of the read and write terms
      * @details If the denominators of log derivative lookup relation are read_term and write_term, then I_i =
@@ -234,29 +267,9 @@ template <typename FF_> class DatabusLookupRelationImpl {
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
-            bool is_read = false;
-            bool nonzero_read_count = false;
             for (size_t i = start; i < end; ++i) {
-                // Determine if the present row contains a databus operation
-                auto q_busread = polynomials.q_busread[i];
-                if constexpr (bus_idx == 0) { // calldata
-                    is_read = q_busread == 1 && polynomials.q_l[i] == 1;
-                    nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
-                }
-                if constexpr (bus_idx == 1) { // secondary_calldata
-                    is_read = q_busread == 1 && polynomials.q_r[i] == 1;
-                    nonzero_read_count = polynomials.secondary_calldata_read_counts[i] > 0;
-                }
-                if constexpr (bus_idx == 2) { // return data
-                    is_read = q_busread == 1 && polynomials.q_o[i] == 1;
-                    nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
-                }
-                // We only compute the inverse if this row contains a read gate or data that has been read
-                if (is_read || nonzero_read_count) {
-                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                    auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                    auto value = compute_read_term<FF>(row, relation_parameters) *
-                                 compute_write_term<FF, bus_idx>(row, relation_parameters);
+                auto value = compute_inverse_denominator<bus_idx>(polynomials, relation_parameters, i);
+                if (!value.is_zero()) {
                     inverse_polynomial.at(i) = value;
                 }
             }
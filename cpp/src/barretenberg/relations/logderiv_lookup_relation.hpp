@@ -149,6 +149,22 @@ template <typename FF_> class LogDerivLookupRelationImpl {
         return result;
     }
 
+    /**
+     * @brief Compute the value of the polynomial I at row i before inversion, i.e. read_term_i*write_term_i, or zero if
+     * the row contains neither a lookup gate nor table data that has been looked up.
+     */
+    template <typename Polynomials>
+    static FF compute_inverse_denominator(const Polynomials& polynomials, const auto& relation_parameters, size_t i)
+    {
+        // We only compute the inverse if this row contains a lookup gate or data that has been looked up
+        if (polynomials.q_lookup.get(i) != 1 && polynomials.lookup_read_tags.get(i) != 1) {
+            return FF(0);
+        }
+        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+        auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
+        return compute_read_term<FF, 0>(row, relation_parameters) * compute_write_term<FF, 0>(row, relation_parameters);
+    }
+
     /**
      * @brief Construct the polynomial I whose components are the inverse of the product of the read and write terms
      * @details If the denominators of log derivative lookup relation are read_term and write_term, then I_i =
@@ -173,12 +189,8 @@ template <typename FF_> class LogDerivLookupRelationImpl {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
             for (size_t i = start; i < end; ++i) {
-                // We only compute the inverse if this row contains a lookup gate or data that has been looked up
-                if (polynomials.q_lookup.get(i) == 1 || polynomials.lookup_read_tags.get(i) == 1) {
-                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                    auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                    auto value = compute_read_term<FF, 0>(row, relation_parameters) *
-                                 compute_write_term<FF, 0>(row, relation_parameters);
+                auto value = compute_inverse_denominator(polynomials, relation_parameters, i);
+                if (!value.is_zero()) {
                     inverse_polynomial.at(i) = value;
                 }
             }
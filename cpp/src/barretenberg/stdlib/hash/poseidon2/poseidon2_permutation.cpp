@@ -10,6 +10,9 @@
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
 
+#include <algorithm>
+#include <optional>
+
 namespace bb::stdlib {
 
 /**
@@ -24,6 +27,24 @@ template <typename Params, typename Builder>
 typename Poseidon2Permutation<Params, Builder>::State Poseidon2Permutation<Params, Builder>::permutation(
     Builder* builder, const typename Poseidon2Permutation<Params, Builder>::State& input)
 {
+    // With gate deduplication, a permutation of a state that has already been permuted reuses the earlier output
+    std::optional<std::array<uint32_t, t>> input_key;
+    const size_t num_gates_before = builder->num_gates;
+    if (builder->deduplicate_gates && std::ranges::none_of(input, [](const auto& elt) { return elt.is_constant(); })) {
+        input_key.emplace();
+        for (size_t i = 0; i < t; ++i) {
+            (*input_key)[i] = builder->real_variable_index[input[i].witness_index];
+        }
+        if (auto it = builder->poseidon2_permutations.find(*input_key); it != builder->poseidon2_permutations.end()) {
+            builder->num_deduplicated_gates += it->second.num_gates;
+            State output;
+            for (size_t i = 0; i < t; ++i) {
+                output[i] = field_t<Builder>::from_witness_index(builder, it->second.outputs[i]);
+            }
+            return output;
+        }
+    }
+
     // deep copy
     State current_state(input);
     NativeState current_native_state;
@@ -111,6 +132,15 @@ typename Poseidon2Permutation<Params, Builder>::State Poseidon2Permutation<Param
                                current_state[1].witness_index,
                                current_state[2].witness_index,
                                current_state[3].witness_index);
+    if (input_key.has_value()) {
+        builder->poseidon2_permutations.emplace(
+            *input_key,
+            typename Builder::Poseidon2PermutationOutput{ .outputs = { current_state[0].witness_index,
+                                                                       current_state[1].witness_index,
+                                                                       current_state[2].witness_index,
+                                                                       current_state[3].witness_index },
+                                                          .num_gates = builder->num_gates - num_gates_before });
+    }
     return current_state;
 }
 
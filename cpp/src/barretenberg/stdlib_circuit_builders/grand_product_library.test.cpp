@@ -28,14 +28,12 @@ template <class FF> class GrandProductTests : public testing::Test {
      * introduced into the calculation has not changed the result.
      * @note This test does confirm the correctness of z_permutation, only that the two implementations yield an
      * identical result.
+     * @tparam circuit_size mock circuit size; large sizes exercise the multithreaded running product
      */
-    template <typename Flavor> static void test_permutation_grand_product_construction()
+    template <typename Flavor, size_t circuit_size = 8> static void test_permutation_grand_product_construction()
     {
         using ProverPolynomials = typename Flavor::ProverPolynomials;
 
-        // Set a mock circuit size
-        static const size_t circuit_size = 8;
-
         // Construct a ProverPolynomials object with completely random polynomials
         ProverPolynomials prover_polynomials;
         for (auto& poly : prover_polynomials.get_to_be_shifted()) {
@@ -87,8 +85,12 @@ template <class FF> class GrandProductTests : public testing::Test {
          */
 
         // Make scratch space for the numerator and denominator accumulators.
-        std::array<std::array<FF, circuit_size>, Flavor::NUM_WIRES> numerator_accum;
-        std::array<std::array<FF, circuit_size>, Flavor::NUM_WIRES> denominator_accum;
+        std::array<std::vector<FF>, Flavor::NUM_WIRES> numerator_accum;
+        std::array<std::vector<FF>, Flavor::NUM_WIRES> denominator_accum;
+        for (size_t k = 0; k < Flavor::NUM_WIRES; ++k) {
+            numerator_accum[k].resize(circuit_size);
+            denominator_accum[k].resize(circuit_size);
+        }
 
         auto wires = prover_polynomials.get_wires();
         auto sigmas = prover_polynomials.get_sigmas();
@@ -137,3 +139,8 @@ TYPED_TEST(GrandProductTests, GrandProductPermutation)
 {
     TestFixture::template test_permutation_grand_product_construction<UltraFlavor>();
 }
+
+TYPED_TEST(GrandProductTests, GrandProductPermutationMultithreaded)
+{
+    TestFixture::template test_permutation_grand_product_construction<UltraFlavor, 1 << 10>();
+}
@@ -81,6 +81,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
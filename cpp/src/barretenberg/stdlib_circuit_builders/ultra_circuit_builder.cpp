@@ -12,6 +12,9 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
 
 #include "barretenberg/serialize/msgpack_impl.hpp"
@@ -50,6 +53,11 @@ void UltraCircuitBuilder_<ExecutionTrace>::finalize_circuit(const bool ensure_no
      * our circuit is finalized, and we must not to execute these functions again.
      */
     if (!circuit_finalized) {
+        if (witness_only) {
+            // No gates, tables or range lists have been recorded, so there is nothing to process.
+            circuit_finalized = true;
+            return;
+        }
         if (ensure_nonzero) {
             add_gates_to_ensure_all_polys_are_non_zero();
         }
@@ -250,6 +258,13 @@ void UltraCircuitBuilder_<ExecutionTrace>::add_gates_to_ensure_all_polys_are_non
 template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::create_add_gate(const add_triple_<FF>& in)
 {
     this->assert_valid_variables({ in.a, in.b, in.c });
+    if (witness_only) {
+        return;
+    }
+    if (is_duplicate_arithmetic_gate({ in.a, in.b, in.c, this->zero_idx },
+                                     { 0, in.a_scaling, in.b_scaling, in.c_scaling, 0, in.const_scaling })) {
+        return;
+    }
 
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, this->zero_idx);
     blocks.arithmetic.q_m().emplace_back(0);
@@ -285,6 +300,15 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_big_mul_add_gate(const mul_qua
                                                                    const bool include_next_gate_w_4)
 {
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
+    if (witness_only) {
+        return;
+    }
+    if (!include_next_gate_w_4 &&
+        is_duplicate_arithmetic_gate(
+            { in.a, in.b, in.c, in.d },
+            { in.mul_scaling, in.a_scaling, in.b_scaling, in.c_scaling, in.d_scaling, in.const_scaling })) {
+        return;
+    }
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, in.d);
     blocks.arithmetic.q_m().emplace_back(include_next_gate_w_4 ? in.mul_scaling * FF(2) : in.mul_scaling);
     blocks.arithmetic.q_1().emplace_back(in.a_scaling);
@@ -319,6 +343,14 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_big_add_gate(const add_quad_<F
                                                                const bool include_next_gate_w_4)
 {
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
+    if (witness_only) {
+        return;
+    }
+    if (!include_next_gate_w_4 &&
+        is_duplicate_arithmetic_gate({ in.a, in.b, in.c, in.d },
+                                     { 0, in.a_scaling, in.b_scaling, in.c_scaling, in.d_scaling, in.const_scaling })) {
+        return;
+    }
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, in.d);
     blocks.arithmetic.q_m().emplace_back(0);
     blocks.arithmetic.q_1().emplace_back(in.a_scaling);
@@ -414,6 +446,14 @@ template <typename ExecutionTrace>
 void UltraCircuitBuilder_<ExecutionTrace>::create_big_mul_gate(const mul_quad_<FF>& in)
 {
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
+    if (witness_only) {
+        return;
+    }
+    if (is_duplicate_arithmetic_gate(
+            { in.a, in.b, in.c, in.d },
+            { in.mul_scaling, in.a_scaling, in.b_scaling, in.c_scaling, in.d_scaling, in.const_scaling })) {
+        return;
+    }
 
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, in.d);
     blocks.arithmetic.q_m().emplace_back(in.mul_scaling);
@@ -442,6 +482,12 @@ template <typename ExecutionTrace>
 void UltraCircuitBuilder_<ExecutionTrace>::create_balanced_add_gate(const add_quad_<FF>& in)
 {
     this->assert_valid_variables({ in.a, in.b, in.c, in.d });
+    if (witness_only ||
+        is_duplicate_arithmetic_gate({ in.a, in.b, in.c, in.d },
+                                     { 0, in.a_scaling, in.b_scaling, in.c_scaling, in.d_scaling, in.const_scaling })) {
+        create_new_range_constraint(in.d, 3);
+        return;
+    }
 
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, in.d);
     blocks.arithmetic.q_m().emplace_back(0);
@@ -485,6 +531,13 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_balanced_add_gate(const add_qu
 template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::create_mul_gate(const mul_triple_<FF>& in)
 {
     this->assert_valid_variables({ in.a, in.b, in.c });
+    if (witness_only) {
+        return;
+    }
+    if (is_duplicate_arithmetic_gate({ in.a, in.b, in.c, this->zero_idx },
+                                     { in.mul_scaling, 0, 0, in.c_scaling, 0, in.const_scaling })) {
+        return;
+    }
 
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, this->zero_idx);
     blocks.arithmetic.q_m().emplace_back(in.mul_scaling);
@@ -515,6 +568,13 @@ template <typename ExecutionTrace>
 void UltraCircuitBuilder_<ExecutionTrace>::create_bool_gate(const uint32_t variable_index)
 {
     this->assert_valid_variables({ variable_index });
+    if (witness_only) {
+        return;
+    }
+    if (is_duplicate_arithmetic_gate({ variable_index, variable_index, this->zero_idx, this->zero_idx },
+                                     { 1, -1, 0, 0, 0, 0 })) {
+        return;
+    }
 
     blocks.arithmetic.populate_wires(variable_index, variable_index, this->zero_idx, this->zero_idx);
     blocks.arithmetic.q_m().emplace_back(1);
@@ -548,6 +608,13 @@ template <typename ExecutionTrace>
 void UltraCircuitBuilder_<ExecutionTrace>::create_poly_gate(const poly_triple_<FF>& in)
 {
     this->assert_valid_variables({ in.a, in.b, in.c });
+    if (witness_only) {
+        return;
+    }
+    if (is_duplicate_arithmetic_gate({ in.a, in.b, in.c, this->zero_idx },
+                                     { in.q_m, in.q_l, in.q_r, in.q_o, 0, in.q_c })) {
+        return;
+    }
 
     blocks.arithmetic.populate_wires(in.a, in.b, in.c, this->zero_idx);
     blocks.arithmetic.q_m().emplace_back(in.q_m);
@@ -591,6 +658,9 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_ecc_add_gate(const ecc_add_gat
      **/
 
     this->assert_valid_variables({ in.x1, in.x2, in.x3, in.y1, in.y2, in.y3 });
+    if (witness_only) {
+        return;
+    }
 
     auto& block = blocks.elliptic;
 
@@ -653,6 +723,9 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_ecc_dbl_gate(const ecc_dbl_gat
      * can also chain double gates together
      **/
     this->assert_valid_variables({ in.x1, in.x3, in.y1, in.y3 });
+    if (witness_only) {
+        return;
+    }
 
     bool previous_elliptic_gate_exists = block.size() > 0;
     bool can_fuse_into_previous_gate = previous_elliptic_gate_exists;
@@ -701,6 +774,13 @@ template <typename ExecutionTrace>
 void UltraCircuitBuilder_<ExecutionTrace>::fix_witness(const uint32_t witness_index, const FF& witness_value)
 {
     this->assert_valid_variables({ witness_index });
+    if (witness_only) {
+        return;
+    }
+    if (is_duplicate_arithmetic_gate({ witness_index, this->zero_idx, this->zero_idx, this->zero_idx },
+                                     { 0, 1, 0, 0, 0, -witness_value })) {
+        return;
+    }
 
     blocks.arithmetic.populate_wires(witness_index, this->zero_idx, this->zero_idx, this->zero_idx);
     blocks.arithmetic.q_m().emplace_back(0);
@@ -736,6 +816,33 @@ uint32_t UltraCircuitBuilder_<ExecutionTrace>::put_constant_variable(const FF& v
     }
 }
 
+/**
+ * @brief If deduplicate_gates is set, check whether an arithmetic gate (with q_arith = 1) enforcing the same constraint
+ * as the given one is already in the circuit, in which case the caller skips it. Otherwise record the gate.
+ * @details Wires are compared by real variable index: copy cycles are only ever merged, so two wires in the same copy
+ * cycle now are still in the same cycle in the final circuit. A gate directly following one that reads the next row
+ * (q_arith = 2 or 3) is always added since it is that row.
+ */
+template <typename ExecutionTrace>
+bool UltraCircuitBuilder_<ExecutionTrace>::is_duplicate_arithmetic_gate(const std::array<uint32_t, 4>& wires,
+                                                                        const std::array<FF, 6>& selectors)
+{
+    if (!deduplicate_gates) {
+        return false;
+    }
+    ArithmeticGateKey key{ .wires = {}, .selectors = selectors };
+    for (size_t i = 0; i < wires.size(); ++i) {
+        key.wires[i] = this->real_variable_index[wires[i]];
+    }
+    const auto& q_arith = blocks.arithmetic.q_arith();
+    const bool is_next_row_of_previous_gate = !q_arith.empty() && (q_arith.back() == 2 || q_arith.back() == 3);
+    if (!arithmetic_gates.insert(key).second && !is_next_row_of_previous_gate) {
+        ++num_deduplicated_gates;
+        return true;
+    }
+    return false;
+}
+
 /**
  * @brief Get the basic table with provided ID from the set of tables for the present circuit; create it if it doesnt
  * yet exist
@@ -772,11 +879,6 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<ExecutionTrace>::create_gates_f
     const size_t num_lookups = read_values[plookup::ColumnIdx::C1].size();
     plookup::ReadData<uint32_t> read_data;
     for (size_t i = 0; i < num_lookups; ++i) {
-        // get basic lookup table; construct and add to builder.lookup_tables if not already present
-        auto& table = get_table(multi_table.basic_table_ids[i]);
-
-        table.lookup_gates.emplace_back(read_values.lookup_entries[i]); // used for constructing sorted polynomials
-
         const auto first_idx = (i == 0) ? key_a_index : this->add_variable(read_values[plookup::ColumnIdx::C1][i]);
         const auto second_idx = (i == 0 && (key_b_index.has_value()))
                                     ? key_b_index.value()
@@ -787,6 +889,14 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<ExecutionTrace>::create_gates_f
         read_data[plookup::ColumnIdx::C2].push_back(second_idx);
         read_data[plookup::ColumnIdx::C3].push_back(third_idx);
         this->assert_valid_variables({ first_idx, second_idx, third_idx });
+        if (witness_only) {
+            continue;
+        }
+
+        // get basic lookup table; construct and add to builder.lookup_tables if not already present
+        auto& table = get_table(multi_table.basic_table_ids[i]);
+
+        table.lookup_gates.emplace_back(read_values.lookup_entries[i]); // used for constructing sorted polynomials
 
         blocks.lookup.q_lookup_type().emplace_back(FF(1));
         blocks.lookup.q_3().emplace_back(FF(table.table_index));
@@ -971,6 +1081,9 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_new_range_constraint(const uin
             this->failure(msg);
         }
     }
+    if (witness_only) {
+        return;
+    }
     if (range_lists.count(target_range) == 0) {
         range_lists.insert({ target_range, create_range_list(target_range) });
     }
@@ -993,7 +1106,11 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_new_range_constraint(const uin
                     } else {
                         // The range constraint we are trying to impose is more restrictive than the existing range
                         // constraint. It would be difficult to remove an existing range check. Instead deep-copy the
-                        // variable and apply a range check to new variable
+                        // variable and apply a range check to new variable. The existing range check is then implied,
+                        // so it can be dropped when processing the range lists.
+                        if (drop_superseded_range_constraints) {
+                            superseded_range_constraints.emplace_back(variable_index);
+                        }
                         const uint32_t copied_witness = this->add_variable(this->get_variable(variable_index));
                         create_add_gate({ .a = variable_index,
                                           .b = copied_witness,
@@ -1015,7 +1132,15 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_new_range_constraint(const uin
     }
 }
 
-template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::process_range_list(RangeList& list)
+/**
+ * @brief Canonicalize a range list and get the sorted values of its variables
+ * @details Variables are replaced by their real variables and deduplicated, and those whose range constraint has been
+ * superseded by a tighter one are dropped. This only reads the state of the builder, so lists can be processed in
+ * parallel.
+ */
+template <typename ExecutionTrace>
+typename UltraCircuitBuilder_<ExecutionTrace>::SortedRangeList UltraCircuitBuilder_<ExecutionTrace>::sort_range_list(
+    RangeList& list, const std::unordered_set<uint32_t>& superseded_variables)
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -1032,36 +1157,63 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
     auto back_iterator = std::unique(list.variable_indices.begin(), list.variable_indices.end());
     list.variable_indices.erase(back_iterator, list.variable_indices.end());
 
+    const size_t num_variables = list.variable_indices.size();
+    std::erase_if(list.variable_indices,
+                  [&](const uint32_t variable_index) { return superseded_variables.contains(variable_index); });
+
     // go over variables
     // iterate over each variable and create mirror variable with same value - with tau tag
     // need to make sure that, in original list, increments of at most 3
-    std::vector<uint32_t> sorted_list;
-    sorted_list.reserve(list.variable_indices.size());
+    SortedRangeList result{ .num_superseded = num_variables - list.variable_indices.size() };
+    result.values.reserve(list.variable_indices.size());
     for (const auto variable_index : list.variable_indices) {
         const auto& field_element = this->get_variable(variable_index);
         const uint32_t shrinked_value = (uint32_t)field_element.from_montgomery_form().data[0];
-        sorted_list.emplace_back(shrinked_value);
+        result.values.emplace_back(shrinked_value);
     }
 
 #ifdef NO_PAR_ALGOS
-    std::sort(sorted_list.begin(), sorted_list.end());
+    std::sort(result.values.begin(), result.values.end());
 #else
-    std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
+    std::sort(std::execution::par_unseq, result.values.begin(), result.values.end());
 #endif
+    return result;
+}
+
+/**
+ * @brief Number of gates (in the delta range block) of a range list with the given number of variables
+ */
+template <typename ExecutionTrace>
+size_t UltraCircuitBuilder_<ExecutionTrace>::get_num_range_list_gates(const size_t num_variables)
+{
+    // list must be padded to a multipe of 4 and larger than 4 (gate_width), and its last row is followed by a dummy
+    // gate
+    constexpr size_t gate_width = NUM_WIRES;
+    size_t padding = (gate_width - (num_variables % gate_width)) % gate_width;
+    if (num_variables <= gate_width) {
+        padding += gate_width;
+    }
+    return (num_variables + padding) / gate_width + 1;
+}
+
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::create_range_list_gates(const RangeList& list,
+                                                                   const std::vector<uint32_t>& sorted_values)
+{
     // list must be padded to a multipe of 4 and larger than 4 (gate_width)
     constexpr size_t gate_width = NUM_WIRES;
-    size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
+    size_t padding = (gate_width - (sorted_values.size() % gate_width)) % gate_width;
 
     std::vector<uint32_t> indices;
-    indices.reserve(padding + sorted_list.size());
+    indices.reserve(padding + gate_width + sorted_values.size());
 
-    if (list.variable_indices.size() <= gate_width) {
+    if (sorted_values.size() <= gate_width) {
         padding += gate_width;
     }
     for (size_t i = 0; i < padding; ++i) {
         indices.emplace_back(this->zero_idx);
     }
-    for (const auto sorted_value : sorted_list) {
+    for (const auto sorted_value : sorted_values) {
         const uint32_t index = this->add_variable(sorted_value);
         assign_tag(index, list.tau_tag);
         indices.emplace_back(index);
@@ -1069,59 +1221,53 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
     create_sort_constraint_with_edges(indices, 0, list.target_range);
 }
 
+/**
+ * @brief Create the sorted lists and delta range gates of all range lists
+ * @details If drop_superseded_range_constraints is set, range constraints that have been superseded by a tighter one
+ * are dropped (and their variables untagged).
+ * The lists are canonicalized and sorted in parallel, then their gates are created in order in pre-reserved blocks, so
+ * the layout of the circuit does not depend on the number of threads.
+ */
 template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::process_range_lists()
 {
-    for (auto& i : range_lists) {
-        process_range_list(i.second);
+    std::unordered_set<uint32_t> superseded_variables;
+    for (const uint32_t variable_index : superseded_range_constraints) {
+        superseded_variables.insert(this->real_variable_index[variable_index]);
     }
-}
 
-/*
- Create range constraint:
-  * add variable index to a list of range constrained variables
-  * data structures: vector of lists, each list contains:
-  *    - the range size
-  *    - the list of variables in the range
-  *    - a generalized permutation tag
-  *
-  * create range constraint parameters: variable index && range size
-  *
-  * std::map<uint64_t, RangeList> range_lists;
-*/
-// Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checkj)
-template <typename ExecutionTrace>
-void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint(const std::vector<uint32_t>& variable_index)
-{
-    constexpr size_t gate_width = NUM_WIRES;
-    ASSERT(variable_index.size() % gate_width == 0);
-    this->assert_valid_variables(variable_index);
+    std::vector<RangeList*> lists;
+    lists.reserve(range_lists.size());
+    for (auto& [target_range, list] : range_lists) {
+        lists.emplace_back(&list);
+    }
+    std::vector<SortedRangeList> sorted_lists(lists.size());
+    parallel_for(lists.size(), [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i], superseded_variables); });
 
-    for (size_t i = 0; i < variable_index.size(); i += gate_width) {
-        blocks.delta_range.populate_wires(
-            variable_index[i], variable_index[i + 1], variable_index[i + 2], variable_index[i + 3]);
+    for (const uint32_t variable_index : superseded_variables) {
+        this->real_variable_tags[variable_index] = DUMMY_TAG;
+    }
 
-        ++this->num_gates;
-        blocks.delta_range.q_m().emplace_back(0);
-        blocks.delta_range.q_1().emplace_back(0);
-        blocks.delta_range.q_2().emplace_back(0);
-        blocks.delta_range.q_3().emplace_back(0);
-        blocks.delta_range.q_c().emplace_back(0);
-        blocks.delta_range.q_arith().emplace_back(0);
-        blocks.delta_range.q_4().emplace_back(0);
-        blocks.delta_range.q_delta_range().emplace_back(1);
-        blocks.delta_range.q_elliptic().emplace_back(0);
-        blocks.delta_range.q_lookup_type().emplace_back(0);
-        blocks.delta_range.q_aux().emplace_back(0);
-        blocks.delta_range.q_poseidon2_external().emplace_back(0);
-        blocks.delta_range.q_poseidon2_internal().emplace_back(0);
-        if constexpr (HasAdditionalSelectors<ExecutionTrace>) {
-            blocks.delta_range.pad_additional();
-        }
-        check_selector_length_consistency();
+    size_t num_sorted_variables = 0;
+    size_t num_delta_range_gates = 0;
+    for (const auto& sorted_list : sorted_lists) {
+        const size_t num_variables = sorted_list.values.size();
+        num_sorted_variables += num_variables;
+        num_delta_range_gates += get_num_range_list_gates(num_variables);
+        num_range_constraint_gates_saved += get_num_range_list_gates(num_variables + sorted_list.num_superseded) -
+                                            get_num_range_list_gates(num_variables);
+    }
+    const size_t num_variables = this->variables.size() + num_sorted_variables;
+    this->variables.reserve(num_variables);
+    this->real_variable_index.reserve(num_variables);
+    this->next_var_index.reserve(num_variables);
+    this->prev_var_index.reserve(num_variables);
+    this->real_variable_tags.reserve(num_variables);
+    blocks.delta_range.reserve(blocks.delta_range.size() + num_delta_range_gates);
+    blocks.arithmetic.reserve(blocks.arithmetic.size() + 2 * lists.size());
+
+    for (size_t i = 0; i < lists.size(); ++i) {
+        create_range_list_gates(*lists[i], sorted_lists[i].values);
     }
-    // dummy gate needed because of sort widget's check of next row
-    create_dummy_gate(
-        blocks.delta_range, variable_index[variable_index.size() - 1], this->zero_idx, this->zero_idx, this->zero_idx);
 }
 
 /**
@@ -1136,6 +1282,9 @@ template <typename ExecutionTrace>
 void UltraCircuitBuilder_<ExecutionTrace>::create_dummy_gate(
     auto& block, const uint32_t& idx_1, const uint32_t& idx_2, const uint32_t& idx_3, const uint32_t& idx_4)
 {
+    if (witness_only) {
+        return;
+    }
     block.populate_wires(idx_1, idx_2, idx_3, idx_4);
     block.q_m().emplace_back(0);
     block.q_1().emplace_back(0);
@@ -1178,24 +1327,16 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_dummy_constraints(const std::v
     }
 }
 
-// Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checks)
+/**
+ * @brief Create the delta range gates of a list of variables, four per row, followed by a dummy gate holding the last
+ * variable since the sort widget reads the next row
+ */
 template <typename ExecutionTrace>
-void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint_with_edges(
-    const std::vector<uint32_t>& variable_index, const FF& start, const FF& end)
+void UltraCircuitBuilder_<ExecutionTrace>::create_delta_range_gates(const std::vector<uint32_t>& variable_index)
 {
-    // Convenient to assume size is at least 8 (gate_width = 4) for separate gates for start and end conditions
     constexpr size_t gate_width = NUM_WIRES;
-    ASSERT(variable_index.size() % gate_width == 0 && variable_index.size() > gate_width);
-    this->assert_valid_variables(variable_index);
-
     auto& block = blocks.delta_range;
-
-    // Add an arithmetic gate to ensure the first input is equal to the start value of the range being checked
-    create_add_gate({ variable_index[0], this->zero_idx, this->zero_idx, 1, 0, 0, -start });
-
-    // enforce range check for all but the final row
-    for (size_t i = 0; i < variable_index.size() - gate_width; i += gate_width) {
-
+    for (size_t i = 0; i < variable_index.size(); i += gate_width) {
         block.populate_wires(variable_index[i], variable_index[i + 1], variable_index[i + 2], variable_index[i + 3]);
         ++this->num_gates;
         block.q_m().emplace_back(0);
@@ -1216,38 +1357,44 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint_with_edges(
         }
         check_selector_length_consistency();
     }
-    // enforce range checks of last row and ending at end
-    if (variable_index.size() > gate_width) {
-        block.populate_wires(variable_index[variable_index.size() - 4],
-                             variable_index[variable_index.size() - 3],
-                             variable_index[variable_index.size() - 2],
-                             variable_index[variable_index.size() - 1]);
-        ++this->num_gates;
-        block.q_m().emplace_back(0);
-        block.q_1().emplace_back(0);
-        block.q_2().emplace_back(0);
-        block.q_3().emplace_back(0);
-        block.q_c().emplace_back(0);
-        block.q_arith().emplace_back(0);
-        block.q_4().emplace_back(0);
-        block.q_delta_range().emplace_back(1);
-        block.q_elliptic().emplace_back(0);
-        block.q_lookup_type().emplace_back(0);
-        block.q_aux().emplace_back(0);
-        block.q_poseidon2_external().emplace_back(0);
-        block.q_poseidon2_internal().emplace_back(0);
-        if constexpr (HasAdditionalSelectors<ExecutionTrace>) {
-            block.pad_additional();
-        }
-        check_selector_length_consistency();
+    // dummy gate needed because of sort widget's check of next row
+    create_dummy_gate(block, variable_index[variable_index.size() - 1], this->zero_idx, this->zero_idx, this->zero_idx);
+}
+
+// Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checks)
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint(const std::vector<uint32_t>& variable_index)
+{
+    constexpr size_t gate_width = NUM_WIRES;
+    ASSERT(variable_index.size() % gate_width == 0);
+    this->assert_valid_variables(variable_index);
+    if (witness_only) {
+        return;
     }
+    create_delta_range_gates(variable_index);
+}
 
-    // dummy gate needed because of sort widget's check of next row
-    // use this gate to check end condition
+// Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checks)
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint_with_edges(
+    const std::vector<uint32_t>& variable_index, const FF& start, const FF& end)
+{
+    // Convenient to assume size is at least 8 (gate_width = 4) for separate gates for start and end conditions
+    constexpr size_t gate_width = NUM_WIRES;
+    ASSERT(variable_index.size() % gate_width == 0 && variable_index.size() > gate_width);
+    this->assert_valid_variables(variable_index);
+    if (witness_only) {
+        return;
+    }
+
+    // Add an arithmetic gate to ensure the first input is equal to the start value of the range being checked
+    create_add_gate({ variable_index[0], this->zero_idx, this->zero_idx, 1, 0, 0, -start });
+
+    // enforce range checks of all rows, the dummy gate after the last row is used to check the end condition
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/879): This was formerly a single arithmetic gate. A
     // dummy gate has been added to allow the previous gate to access the required wire data via shifts, allowing the
     // arithmetic gate to occur out of sequence.
-    create_dummy_gate(block, variable_index[variable_index.size() - 1], this->zero_idx, this->zero_idx, this->zero_idx);
+    create_delta_range_gates(variable_index);
     create_add_gate({ variable_index[variable_index.size() - 1], this->zero_idx, this->zero_idx, 1, 0, 0, -end });
 }
 
@@ -1611,14 +1758,16 @@ void UltraCircuitBuilder_<ExecutionTrace>::range_constrain_two_limbs(const uint3
     const std::array<uint32_t, 5> lo_sublimbs = get_sublimbs(lo_idx, lo_masks);
     const std::array<uint32_t, 5> hi_sublimbs = get_sublimbs(hi_idx, hi_masks);
 
-    blocks.aux.populate_wires(lo_sublimbs[0], lo_sublimbs[1], lo_sublimbs[2], lo_idx);
-    blocks.aux.populate_wires(lo_sublimbs[3], lo_sublimbs[4], hi_sublimbs[0], hi_sublimbs[1]);
-    blocks.aux.populate_wires(hi_sublimbs[2], hi_sublimbs[3], hi_sublimbs[4], hi_idx);
+    if (!witness_only) {
+        blocks.aux.populate_wires(lo_sublimbs[0], lo_sublimbs[1], lo_sublimbs[2], lo_idx);
+        blocks.aux.populate_wires(lo_sublimbs[3], lo_sublimbs[4], hi_sublimbs[0], hi_sublimbs[1]);
+        blocks.aux.populate_wires(hi_sublimbs[2], hi_sublimbs[3], hi_sublimbs[4], hi_idx);
 
-    apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_1);
-    apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_2);
-    apply_aux_selectors(AUX_SELECTORS::NONE);
-    this->num_gates += 3;
+        apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_1);
+        apply_aux_selectors(AUX_SELECTORS::LIMB_ACCUMULATE_2);
+        apply_aux_selectors(AUX_SELECTORS::NONE);
+        this->num_gates += 3;
+    }
 
     for (size_t i = 0; i < 5; i++) {
         if (lo_masks[i] != 0) {
@@ -1748,21 +1897,23 @@ std::array<uint32_t, 2> UltraCircuitBuilder_<ExecutionTrace>::evaluate_non_nativ
                         true);
     create_dummy_gate(blocks.arithmetic, this->zero_idx, this->zero_idx, this->zero_idx, lo_0_idx);
 
-    blocks.aux.populate_wires(input.a[1], input.b[1], input.r[0], lo_0_idx);
-    apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_1);
-    ++this->num_gates;
+    if (!witness_only) {
+        blocks.aux.populate_wires(input.a[1], input.b[1], input.r[0], lo_0_idx);
+        apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_1);
+        ++this->num_gates;
 
-    blocks.aux.populate_wires(input.a[0], input.b[0], input.a[3], input.b[3]);
-    apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_2);
-    ++this->num_gates;
+        blocks.aux.populate_wires(input.a[0], input.b[0], input.a[3], input.b[3]);
+        apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_2);
+        ++this->num_gates;
 
-    blocks.aux.populate_wires(input.a[2], input.b[2], input.r[3], hi_0_idx);
-    apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_3);
-    ++this->num_gates;
+        blocks.aux.populate_wires(input.a[2], input.b[2], input.r[3], hi_0_idx);
+        apply_aux_selectors(AUX_SELECTORS::NON_NATIVE_FIELD_3);
+        ++this->num_gates;
 
-    blocks.aux.populate_wires(input.a[1], input.b[1], input.r[2], hi_1_idx);
-    apply_aux_selectors(AUX_SELECTORS::NONE);
-    ++this->num_gates;
+        blocks.aux.populate_wires(input.a[1], input.b[1], input.r[2], hi_1_idx);
+        apply_aux_selectors(AUX_SELECTORS::NONE);
+        ++this->num_gates;
+    }
 
     /**
      * product gate 6
@@ -1960,6 +2111,12 @@ std::array<uint32_t, 5> UltraCircuitBuilder_<ExecutionTrace>::evaluate_non_nativ
     const auto z_3 = this->add_variable(z_3value);
     const auto z_p = this->add_variable(z_pvalue);
 
+    if (witness_only) {
+        return std::array<uint32_t, 5>{
+            z_0, z_1, z_2, z_3, z_p,
+        };
+    }
+
     /**
      *   we want the following layout in program memory
      *   (x - y = z)
@@ -2086,6 +2243,12 @@ std::array<uint32_t, 5> UltraCircuitBuilder_<ExecutionTrace>::evaluate_non_nativ
     const auto z_3 = this->add_variable(z_3value);
     const auto z_p = this->add_variable(z_pvalue);
 
+    if (witness_only) {
+        return std::array<uint32_t, 5>{
+            z_0, z_1, z_2, z_3, z_p,
+        };
+    }
+
     /**
      *   we want the following layout in program memory
      *   (x - y = z)
@@ -2813,6 +2976,9 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
 template <typename FF>
 void UltraCircuitBuilder_<FF>::create_poseidon2_external_gate(const poseidon2_external_gate_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     auto& block = this->blocks.poseidon2_external;
     block.populate_wires(in.a, in.b, in.c, in.d);
     block.q_m().emplace_back(0);
@@ -2841,6 +3007,9 @@ void UltraCircuitBuilder_<FF>::create_poseidon2_external_gate(const poseidon2_ex
 template <typename FF>
 void UltraCircuitBuilder_<FF>::create_poseidon2_internal_gate(const poseidon2_internal_gate_<FF>& in)
 {
+    if (witness_only) {
+        return;
+    }
     auto& block = this->blocks.poseidon2_internal;
     block.populate_wires(in.a, in.b, in.c, in.d);
     block.q_m().emplace_back(0);
@@ -3035,6 +3204,170 @@ template <typename ExecutionTrace> msgpack::sbuffer UltraCircuitBuilder_<Executi
     return buffer;
 }
 
+/**
+ * @brief Append the circuit of a builder that was constructed from the same first num_shared_variables variables as
+ * this one (e.g. both from the same ACIR witness), so that parts of a circuit can be constructed in parallel.
+ * @details Variables of other beyond the shared ones are added as new variables, except that its constants are mapped
+ * to the constants of this builder. Its gates are appended to the corresponding blocks in order, with lookup gates
+ * pointing to the tables of this builder, and its copy constraints and range constraints are replayed. The gates
+ * fixing other's constants and the gates holding the variables of its range lists are dropped since this builder
+ * creates its own, so the resulting gate count is the same as if the gadgets had been constructed in this builder.
+ * The order of gates differs though, so the circuit (and its verification key) is equivalent but not identical.
+ * Neither builder may be finalized and other must not use ROM/RAM, public inputs or a (Mega) op queue. These are
+ * checked in release builds too, since appending such a builder would silently drop constraints.
+ */
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::append_circuit(UltraCircuitBuilder_&& other,
+                                                          const size_t num_shared_variables)
+{
+    if (circuit_finalized || other.circuit_finalized) {
+        throw_or_abort("append_circuit: cannot append to or from a finalized circuit");
+    }
+    if (!other.rom_arrays.empty() || !other.ram_arrays.empty() || !other.memory_read_records.empty() ||
+        !other.memory_write_records.empty()) {
+        throw_or_abort("append_circuit: the appended circuit must not use ROM/RAM");
+    }
+    if (!other.public_inputs.empty()) {
+        throw_or_abort("append_circuit: the appended circuit must not have public inputs");
+    }
+    if (num_shared_variables > this->get_num_variables() || num_shared_variables > other.get_num_variables()) {
+        throw_or_abort("append_circuit: more shared variables than variables in the circuits");
+    }
+
+    // The variables added by create_range_list (multiples of the step size up to the target range)
+    std::unordered_set<uint32_t> range_list_variables;
+    for (const auto& [target_range, list] : other.range_lists) {
+        const size_t num_list_variables = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        range_list_variables.insert(list.variable_indices.begin(), list.variable_indices.begin() + num_list_variables);
+    }
+
+    static constexpr uint32_t UNMAPPED = UINT32_MAX;
+    std::vector<uint32_t> index_map(other.get_num_variables(), UNMAPPED);
+    for (uint32_t idx = 0; idx < num_shared_variables; ++idx) {
+        index_map[idx] = idx;
+    }
+    // Add the constants of other in the order they were created, so that the resulting circuit is deterministic
+    std::vector<std::pair<uint32_t, FF>> other_constants;
+    other_constants.reserve(other.constant_variable_indices.size());
+    for (const auto& [value, idx] : other.constant_variable_indices) {
+        other_constants.emplace_back(idx, value);
+    }
+    std::sort(other_constants.begin(), other_constants.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+    for (const auto& [idx, value] : other_constants) {
+        index_map[idx] = put_constant_variable(value);
+    }
+    for (size_t idx = num_shared_variables; idx < other.get_num_variables(); ++idx) {
+        if (index_map[idx] == UNMAPPED && !range_list_variables.contains(static_cast<uint32_t>(idx))) {
+            index_map[idx] = this->add_variable(other.get_variable(static_cast<uint32_t>(idx)));
+        }
+    }
+    const auto map_variable = [&](const uint32_t idx) {
+        ASSERT(index_map[idx] != UNMAPPED);
+        return index_map[idx];
+    };
+
+    // Map the lookup tables of other to the tables of this builder
+    std::vector<size_t> table_index_map(other.lookup_tables.size());
+    for (auto& table : other.lookup_tables) {
+        auto& target_table = get_table(table.id);
+        table_index_map[table.table_index] = target_table.table_index;
+        target_table.lookup_gates.insert(
+            target_table.lookup_gates.end(), table.lookup_gates.begin(), table.lookup_gates.end());
+    }
+
+    // Drop other's gates that fix its constants or hold the variables of its range lists
+    const auto is_dropped_gate = [&](auto& gate_block, const size_t row) {
+        if (&gate_block != &other.blocks.arithmetic) {
+            return false;
+        }
+        auto& block = other.blocks.arithmetic;
+        const uint32_t w_l = block.w_l()[row];
+        const bool other_wires_are_zero = block.w_r()[row] == other.zero_idx && block.w_o()[row] == other.zero_idx &&
+                                          block.w_4()[row] == other.zero_idx;
+        const bool is_constant = other.constant_variable_indices.contains(other.get_variable(w_l)) &&
+                                 other.constant_variable_indices.at(other.get_variable(w_l)) == w_l;
+        if (is_constant && other_wires_are_zero && block.q_arith()[row] == 1 && block.q_1()[row] == 1 &&
+            block.q_c()[row] == -other.get_variable(w_l) && block.q_m()[row] == 0 && block.q_2()[row] == 0 &&
+            block.q_3()[row] == 0 && block.q_4()[row] == 0) {
+            return true;
+        }
+        bool has_range_list_variable = false;
+        for (auto& wire : block.wires) {
+            if (range_list_variables.contains(wire[row])) {
+                has_range_list_variable = true;
+            } else if (wire[row] != other.zero_idx) {
+                return false;
+            }
+        }
+        for (auto& selector : block.selectors) {
+            if (selector[row] != 0) {
+                return false;
+            }
+        }
+        return has_range_list_variable;
+    };
+
+    for (auto [block, other_block] : zip_view(blocks.get(), other.blocks.get())) {
+        const bool is_lookup_block = &block == &blocks.lookup;
+        for (size_t row = 0; row < other_block.size(); ++row) {
+            if (is_dropped_gate(other_block, row)) {
+                continue;
+            }
+            block.populate_wires(map_variable(other_block.w_l()[row]),
+                                 map_variable(other_block.w_r()[row]),
+                                 map_variable(other_block.w_o()[row]),
+                                 map_variable(other_block.w_4()[row]));
+            for (auto [selector, other_selector] : zip_view(block.selectors, other_block.selectors)) {
+                selector.emplace_back(other_selector[row]);
+            }
+            if (is_lookup_block && other_block.q_lookup_type()[row] != 0) {
+                const auto table_index = static_cast<size_t>(uint256_t(other_block.q_3()[row]));
+                block.q_3().back() = FF(table_index_map[table_index]);
+            }
+            ++this->num_gates;
+        }
+    }
+    check_selector_length_consistency();
+
+    // Replay the copy constraints, then the range constraints which depend on the merged equivalence classes
+    for (uint32_t idx = 0; idx < other.get_num_variables(); ++idx) {
+        const uint32_t real_idx = other.real_variable_index[idx];
+        if (real_idx != idx && index_map[idx] != UNMAPPED) {
+            this->assert_equal(map_variable(real_idx), map_variable(idx));
+        }
+    }
+    for (const auto& [target_range, list] : other.range_lists) {
+        const size_t num_list_variables = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = num_list_variables; i < list.variable_indices.size(); ++i) {
+            create_new_range_constraint(map_variable(list.variable_indices[i]), target_range);
+        }
+    }
+
+    for (auto entry : other.cached_partial_non_native_field_multiplications) {
+        for (size_t i = 0; i < 4; ++i) {
+            entry.a[i] = map_variable(entry.a[i]);
+            entry.b[i] = map_variable(entry.b[i]);
+        }
+        entry.lo_0 = map_variable(entry.lo_0);
+        entry.hi_0 = map_variable(entry.hi_0);
+        entry.hi_1 = map_variable(entry.hi_1);
+        cached_partial_non_native_field_multiplications.emplace_back(entry);
+    }
+    for (const auto& idx : other.used_witnesses) {
+        used_witnesses.emplace_back(map_variable(idx));
+    }
+    for (const auto& idx : other.superseded_range_constraints) {
+        superseded_range_constraints.emplace_back(map_variable(idx));
+    }
+    num_deduplicated_gates += other.num_deduplicated_gates;
+
+    if (other.failed() && !this->failed()) {
+        this->failure(other.err());
+    }
+}
+
 template class UltraCircuitBuilder_<UltraExecutionTraceBlocks>;
 template class UltraCircuitBuilder_<MegaExecutionTraceBlocks>;
 // To enable this we need to template plookup
@@ -5,6 +5,7 @@
 // =====================
 
 #pragma once
+#include "barretenberg/common/utils.hpp"
 #include "barretenberg/honk/execution_trace/mega_execution_trace.hpp"
 #include "barretenberg/honk/execution_trace/ultra_execution_trace.hpp"
 #include "barretenberg/honk/types/circuit_type.hpp"
@@ -15,7 +16,9 @@
 
 // TODO(md): note that this has now been added
 #include "circuit_builder_base.hpp"
+#include <array>
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "barretenberg/serialize/msgpack.hpp"
@@ -88,6 +91,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
         }
     };
 
+    struct SortedRangeList {
+        std::vector<uint32_t> values;
+        size_t num_superseded = 0; // number of variables dropped because of a tighter range constraint
+    };
+
     /**
      * @brief A ROM memory record that can be ordered
      *
@@ -292,17 +300,59 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
         uint32_t hi_3_idx;
     };
 
+    /**
+     * @brief An arithmetic gate (with q_arith = 1) identified by the real variable indices of its wires and by its
+     * selectors. Two gates with the same key enforce the same constraint.
+     */
+    struct ArithmeticGateKey {
+        std::array<uint32_t, 4> wires;
+        std::array<FF, 6> selectors; // q_m, q_1, q_2, q_3, q_4, q_c
+
+        bool operator==(const ArithmeticGateKey& other) const = default;
+
+        struct Hash {
+            size_t operator()(const ArithmeticGateKey& key) const
+            {
+                const auto& [w_1, w_2, w_3, w_4] = key.wires;
+                const auto& [q_m, q_1, q_2, q_3, q_4, q_c] = key.selectors;
+                return utils::hash_as_tuple(w_1, w_2, w_3, w_4, q_m, q_1, q_2, q_3, q_4, q_c);
+            }
+        };
+    };
+
+    /**
+     * @brief The output witnesses of a Poseidon2 permutation, and the number of gates it took to compute them.
+     */
+    struct Poseidon2PermutationOutput {
+        std::array<uint32_t, 4> outputs;
+        size_t num_gates;
+
+        bool operator==(const Poseidon2PermutationOutput& other) const = default;
+    };
+
+    struct WireIndicesHash {
+        size_t operator()(const std::array<uint32_t, 4>& wires) const
+        {
+            return utils::hash_as_tuple(wires[0], wires[1], wires[2], wires[3]);
+        }
+    };
+
     // Storage for wires and selectors for all gate types
     ExecutionTrace blocks;
 
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
-    std::map<FF, uint32_t> constant_variable_indices;
+    std::unordered_map<FF, uint32_t> constant_variable_indices;
 
     // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
     std::vector<plookup::BasicTable> lookup_tables;
 
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    // Variables whose range constraint has been superseded by a tighter one (applied to a copy of the variable), only
+    // recorded if drop_superseded_range_constraints is set
+    std::vector<uint32_t> superseded_range_constraints;
+    // Gates saved by dropping superseded range constraints from the range lists
+    size_t num_range_constraint_gates_saved = 0;
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
@@ -331,6 +381,34 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
 
     bool circuit_finalized = false;
 
+    /**
+     * @brief Only compute the witness: gadgets and constraints still add their variables (and copy constraints, which
+     * is how placeholder witnesses get their values) but arithmetic, elliptic, lookup, range, non-native field and
+     * Poseidon2 gates are not recorded, nor are range lists (so their variables are not added either) and lookup
+     * tables. Range constraints still flag a failure when the value is out of range. A witness-only circuit cannot be
+     * proven; set this before adding any gates.
+     */
+    bool witness_only = false;
+
+    /**
+     * @brief Hash-cons gates as they are added: an arithmetic gate identical to one already in the circuit (same
+     * selectors, and wires in the same copy cycles) is skipped, and so is a Poseidon2 permutation of an input state
+     * that has already been permuted, whose earlier output is reused instead. Set this before adding any gates.
+     */
+    bool deduplicate_gates = false;
+    std::unordered_set<ArithmeticGateKey, typename ArithmeticGateKey::Hash> arithmetic_gates;
+    // The Poseidon2 permutations in the circuit, by the real variable indices of their input state
+    std::unordered_map<std::array<uint32_t, 4>, Poseidon2PermutationOutput, WireIndicesHash> poseidon2_permutations;
+    // Gates that deduplicate_gates saved
+    size_t num_deduplicated_gates = 0;
+
+    /**
+     * @brief When a variable gets a tighter range constraint than the one it already has, drop the looser one (which
+     * the tighter one on its copy implies) from its range list at finalization. This shrinks the range lists, so the
+     * verification key differs. Set this before adding any gates.
+     */
+    bool drop_superseded_range_constraints = false;
+
     std::vector<fr> ipa_proof;
 
     void populate_public_inputs_block();
@@ -387,12 +465,20 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
         , constant_variable_indices(other.constant_variable_indices)
         , lookup_tables(other.lookup_tables)
         , range_lists(other.range_lists)
+        , superseded_range_constraints(other.superseded_range_constraints)
+        , num_range_constraint_gates_saved(other.num_range_constraint_gates_saved)
         , ram_arrays(other.ram_arrays)
         , rom_arrays(other.rom_arrays)
         , memory_read_records(other.memory_read_records)
         , memory_write_records(other.memory_write_records)
         , cached_partial_non_native_field_multiplications(other.cached_partial_non_native_field_multiplications)
         , circuit_finalized(other.circuit_finalized)
+        , witness_only(other.witness_only)
+        , deduplicate_gates(other.deduplicate_gates)
+        , arithmetic_gates(other.arithmetic_gates)
+        , poseidon2_permutations(other.poseidon2_permutations)
+        , num_deduplicated_gates(other.num_deduplicated_gates)
+        , drop_superseded_range_constraints(other.drop_superseded_range_constraints)
         , ipa_proof(other.ipa_proof){};
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other) noexcept
@@ -403,12 +489,20 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
 
         lookup_tables = other.lookup_tables;
         range_lists = other.range_lists;
+        superseded_range_constraints = other.superseded_range_constraints;
+        num_range_constraint_gates_saved = other.num_range_constraint_gates_saved;
         ram_arrays = other.ram_arrays;
         rom_arrays = other.rom_arrays;
         memory_read_records = other.memory_read_records;
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        witness_only = other.witness_only;
+        deduplicate_gates = other.deduplicate_gates;
+        arithmetic_gates = other.arithmetic_gates;
+        poseidon2_permutations = other.poseidon2_permutations;
+        num_deduplicated_gates = other.num_deduplicated_gates;
+        drop_superseded_range_constraints = other.drop_superseded_range_constraints;
         ipa_proof = other.ipa_proof;
         return *this;
     };
@@ -439,6 +533,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
 
     void finalize_circuit(const bool ensure_nonzero);
 
+    void append_circuit(UltraCircuitBuilder_&& other, const size_t num_shared_variables);
+
     void add_gates_to_ensure_all_polys_are_non_zero();
 
     void create_add_gate(const add_triple_<FF>& in) override;
@@ -775,6 +871,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
         std::string const& msg = "decompose_into_default_range_better_for_oddlimbnum");
     void create_dummy_gate(auto& block, const uint32_t&, const uint32_t&, const uint32_t&, const uint32_t&);
     void create_dummy_constraints(const std::vector<uint32_t>& variable_index);
+    void create_delta_range_gates(const std::vector<uint32_t>& variable_index);
     void create_sort_constraint(const std::vector<uint32_t>& variable_index);
     void create_sort_constraint_with_edges(const std::vector<uint32_t>& variable_index, const FF&, const FF&);
     void assign_tag(const uint32_t variable_index, const uint32_t tag)
@@ -802,9 +899,13 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
     }
 
     RangeList create_range_list(const uint64_t target_range);
-    void process_range_list(RangeList& list);
+    SortedRangeList sort_range_list(RangeList& list, const std::unordered_set<uint32_t>& superseded_variables);
+    static size_t get_num_range_list_gates(const size_t num_variables);
+    void create_range_list_gates(const RangeList& list, const std::vector<uint32_t>& sorted_values);
     void process_range_lists();
 
+    bool is_duplicate_arithmetic_gate(const std::array<uint32_t, 4>& wires, const std::array<FF, 6>& selectors);
+
     /**
      * Custom Gate Selectors
      **/
@@ -22,6 +22,12 @@ namespace bb {
 template <typename Flavor>
 concept specifiesUnivariateChunks = std::convertible_to<decltype(Flavor::MAX_CHUNK_THREAD_PORTION_SIZE), size_t>;
 
+// Whether a Flavor provides extended edges that are only computed for the columns that the relations read.
+// Used for the AVM.
+template <typename Flavor>
+concept specifiesLazyExtendedEdges =
+    requires { typename Flavor::template LazyExtendedEdges<typename Flavor::ProverPolynomials>; };
+
 /*! \brief Imlementation of the Sumcheck prover round.
     \class SumcheckProverRound
     \details
@@ -248,23 +254,36 @@ template <typename Flavor> class SumcheckProverRound {
         parallel_for(num_threads, [&](size_t thread_idx) {
             // Initialize the thread accumulator to 0
             Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
-            // Construct extended univariates containers; one per thread
-            ExtendedEdges extended_edges;
-            for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
-                size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
-                size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
-                for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                    extend_edges(extended_edges, polynomials, edge_idx);
-                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
-                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
-                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
-                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
-                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                    extended_edges,
-                                                    relation_parameters,
-                                                    gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+            const auto accumulate_edges = [&](auto& extended_edges, const auto& extend) {
+                for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
+                    size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
+                    size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
+                    for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                        extend(extended_edges, edge_idx);
+                        // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                        // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators
+                        // for \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+                        // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                        // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                        accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                        extended_edges,
+                                                        relation_parameters,
+                                                        gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                    }
                 }
+            };
+            // Construct extended univariates containers; one per thread
+            if constexpr (specifiesLazyExtendedEdges<Flavor>) {
+                // Columns are only extended when a relation that is not skipped on the edge reads them.
+                using LazyExtendedEdges = typename Flavor::template LazyExtendedEdges<
+                    std::remove_cvref_t<ProverPolynomialsOrPartiallyEvaluatedMultivariates>>;
+                static_assert(!Flavor::USE_SHORT_MONOMIALS);
+                LazyExtendedEdges extended_edges(polynomials);
+                accumulate_edges(extended_edges, [](auto& edges, size_t edge_idx) { edges.set_edge(edge_idx); });
+            } else {
+                ExtendedEdges extended_edges;
+                accumulate_edges(extended_edges,
+                                 [&](auto& edges, size_t edge_idx) { extend_edges(edges, polynomials, edge_idx); });
             }
         });
 
@@ -5,6 +5,7 @@
 // =====================
 
 #include "trace_to_polynomials.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ext/starknet/stdlib_circuit_builders/ultra_starknet_flavor.hpp"
 #include "barretenberg/ext/starknet/stdlib_circuit_builders/ultra_starknet_zk_flavor.hpp"
 
@@ -13,19 +14,25 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_zk_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_zk_flavor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <tuple>
+
 namespace bb {
 
 template <class Flavor>
 void TraceToPolynomials<Flavor>::populate(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured)
+                                          bool is_structured,
+                                          bool compute_precomputed)
 {
 
     PROFILE_THIS_NAME("trace populate");
 
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, compute_precomputed);
 
     if constexpr (IsUltraOrMegaHonk<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -45,7 +52,7 @@ void TraceToPolynomials<Flavor>::populate(Builder& builder,
     }
 
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
-    {
+    if (compute_precomputed) {
 
         PROFILE_THIS_NAME("compute_permutation_argument_polynomials");
 
@@ -74,7 +81,7 @@ void TraceToPolynomials<Flavor>::add_memory_records_to_proving_key(TraceData& tr
 
 template <class Flavor>
 typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool compute_precomputed)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
@@ -82,48 +89,18 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
     TraceData trace_data{ builder, proving_key };
 
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
-
+    std::vector<uint32_t> block_offsets;
+    // For each block in the trace, compute its offset and record its metadata. The blocks are populated afterwards.
     for (auto& block : builder.blocks.get()) {
-        auto block_size = static_cast<uint32_t>(block.size());
+        block_offsets.push_back(offset);
 
         // Save ranges over which the blocks are "active" for use in structured commitments
         if constexpr (IsUltraOrMegaHonk<Flavor>) { // Mega and Ultra
-            PROFILE_THIS_NAME("construct_active_indices");
             if (block.size() > 0) {
                 proving_key.active_region_data.add_range(offset, offset + block.size());
             }
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        {
-
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
-            }
-        }
-
-        // Insert the selector values for this block into the selector polynomials at the correct offset
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
-            auto& selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
-            }
-        }
-
         // Store the offset of the block containing RAM/ROM read/write gates for use in updating memory records
         if (block.has_ram_rom) {
             trace_data.ram_rom_offset = offset;
@@ -138,9 +115,125 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
         offset += block.get_fixed_size(is_structured);
     }
 
+    // Populate the wire and selector polynomials. Every block has a known offset, so ranges of rows of all blocks are
+    // populated in parallel; each row of the polynomials is written by exactly one range.
+    {
+        PROFILE_THIS_NAME("populating wires and selectors");
+
+        const auto blocks = builder.blocks.get();
+        const std::vector<RowRange> row_ranges = split_blocks_into_row_ranges(builder);
+        parallel_for(row_ranges.size(), [&](size_t range_idx) {
+            const RowRange& range = row_ranges[range_idx];
+            const auto& block = blocks[range.block_idx];
+            const uint32_t block_offset = block_offsets[range.block_idx];
+
+            // Insert the real witness values from this block into the wire polys at the correct offset
+            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                for (uint32_t block_row_idx = range.start; block_row_idx < range.end; ++block_row_idx) {
+                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
+                    trace_data.wires[wire_idx].at(block_row_idx + block_offset) = builder.get_variable(var_idx);
+                }
+            }
+
+            // Insert the selector values for this block into the selector polynomials at the correct offset
+            // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor
+            // consistency
+            for (size_t selector_idx = 0; compute_precomputed && selector_idx < NUM_SELECTORS; selector_idx++) {
+                auto& selector = block.selectors[selector_idx];
+                for (uint32_t block_row_idx = range.start; block_row_idx < range.end; ++block_row_idx) {
+                    trace_data.selectors[selector_idx].set_if_valid_index(block_row_idx + block_offset,
+                                                                          selector[block_row_idx]);
+                }
+            }
+        });
+    }
+
+    if (compute_precomputed) {
+        PROFILE_THIS_NAME("construct_copy_cycles");
+
+        trace_data.copy_cycles = construct_copy_cycles(builder, block_offsets);
+    }
+
     return trace_data;
 }
 
+template <class Flavor>
+std::vector<typename TraceToPolynomials<Flavor>::RowRange> TraceToPolynomials<Flavor>::split_blocks_into_row_ranges(
+    const Builder& builder)
+{
+    constexpr uint32_t ROWS_PER_RANGE = 1 << 14;
+    std::vector<RowRange> row_ranges;
+    const auto blocks = builder.blocks.get();
+    for (size_t block_idx = 0; block_idx < blocks.size(); ++block_idx) {
+        const auto block_size = static_cast<uint32_t>(blocks[block_idx].size());
+        for (uint32_t start = 0; start < block_size; start += ROWS_PER_RANGE) {
+            row_ranges.push_back({ block_idx, start, std::min(start + ROWS_PER_RANGE, block_size) });
+        }
+    }
+    return row_ranges;
+}
+
+template <class Flavor>
+CopyCycles TraceToPolynomials<Flavor>::construct_copy_cycles(const Builder& builder,
+                                                             const std::vector<uint32_t>& block_offsets)
+{
+    const auto blocks = builder.blocks.get();
+    const std::vector<RowRange> row_ranges = split_blocks_into_row_ranges(builder);
+    const auto for_each_node = [&](const RowRange& range, const auto& func) {
+        const auto& block = blocks[range.block_idx];
+        const uint32_t offset = block_offsets[range.block_idx];
+        for (uint32_t block_row_idx = range.start; block_row_idx < range.end; ++block_row_idx) {
+            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                uint32_t real_var_idx = builder.real_variable_index[block.wires[wire_idx][block_row_idx]];
+                func(real_var_idx, cycle_node{ wire_idx, block_row_idx + offset });
+            }
+        }
+    };
+
+    const size_t num_cycles = builder.variables.size();
+    std::vector<std::atomic<uint32_t>> counts(num_cycles);
+
+    // Count the nodes of each cycle
+    parallel_for(row_ranges.size(), [&](size_t range_idx) {
+        for_each_node(row_ranges[range_idx], [&](uint32_t real_var_idx, const cycle_node&) {
+            counts[real_var_idx].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    CopyCycles copy_cycles;
+    copy_cycles.offsets.resize(num_cycles + 1);
+    copy_cycles.offsets[0] = 0;
+    for (size_t cycle_idx = 0; cycle_idx < num_cycles; ++cycle_idx) {
+        copy_cycles.offsets[cycle_idx + 1] = copy_cycles.offsets[cycle_idx] + counts[cycle_idx].load();
+        counts[cycle_idx].store(0, std::memory_order_relaxed); // reused as the fill cursor of the cycle
+    }
+    copy_cycles.nodes.resize(copy_cycles.offsets[num_cycles]);
+
+    // Write each node into its cycle
+    parallel_for(row_ranges.size(), [&](size_t range_idx) {
+        for_each_node(row_ranges[range_idx], [&](uint32_t real_var_idx, const cycle_node& node) {
+            size_t position = copy_cycles.offsets[real_var_idx] +
+                              counts[real_var_idx].fetch_add(1, std::memory_order_relaxed);
+            copy_cycles.nodes[position] = node;
+        });
+    });
+
+    // Put the nodes of each cycle in trace order
+    parallel_for_range(num_cycles, [&](size_t start, size_t end) {
+        for (size_t cycle_idx = start; cycle_idx < end; ++cycle_idx) {
+            auto first = copy_cycles.nodes.begin() + static_cast<ptrdiff_t>(copy_cycles.offsets[cycle_idx]);
+            auto last = copy_cycles.nodes.begin() + static_cast<ptrdiff_t>(copy_cycles.offsets[cycle_idx + 1]);
+            if (last - first > 1) {
+                std::sort(first, last, [](const cycle_node& lhs, const cycle_node& rhs) {
+                    return std::tie(lhs.gate_idx, lhs.wire_idx) < std::tie(rhs.gate_idx, rhs.wire_idx);
+                });
+            }
+        }
+    });
+
+    return copy_cycles;
+}
+
 template <class Flavor>
 void TraceToPolynomials<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
                                                                  typename Flavor::ProvingKey& proving_key)
@@ -27,8 +27,8 @@ template <class Flavor> class TraceToPolynomials {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // For each variable, the addresses into the wire polynomials whose values are copy constrained to it
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -63,11 +63,6 @@ template <class Flavor> class TraceToPolynomials {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.variables.size());
-            }
         }
     };
 
@@ -81,10 +76,24 @@ template <class Flavor> class TraceToPolynomials {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param compute_precomputed whether to compute the selector and sigma/id polynomials; false if the proving key
+     * already holds them (e.g. copied from a PrecomputedPolynomialsCache), in which case only the wires are populated
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder, ProvingKey&, bool is_structured = false, bool compute_precomputed = true);
 
   private:
+    // A range of rows of one block; the unit of work when processing the blocks in parallel
+    struct RowRange {
+        size_t block_idx;
+        uint32_t start;
+        uint32_t end;
+    };
+
+    /**
+     * @brief Split the rows of all blocks into ranges of bounded size, so that large blocks are split across threads
+     */
+    static std::vector<RowRange> split_blocks_into_row_ranges(const Builder& builder);
+
     /**
      * @brief Add the memory records indicating which rows correspond to RAM/ROM reads/writes
      * @details The 4th wire of RAM/ROM read/write gates is generated at proving time as a linear combination of the
@@ -108,11 +117,24 @@ template <class Flavor> class TraceToPolynomials {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param compute_precomputed whether to construct the selector polynomials and copy cycles
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool compute_precomputed = true);
+
+    /**
+     * @brief Construct the copy cycles of the circuit as a flat CSR array
+     * @details Two passes over the wires of all blocks, in parallel: the first counts the nodes of each cycle, from
+     * which the cycle offsets are computed, and the second writes every node into its cycle. The nodes of a cycle are
+     * then sorted by (row, column), i.e. in trace order, so the result does not depend on the scheduling.
+     *
+     * @param builder
+     * @param block_offsets the offset of each block in the trace
+     */
+    static CopyCycles construct_copy_cycles(const Builder& builder, const std::vector<uint32_t>& block_offsets);
 
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
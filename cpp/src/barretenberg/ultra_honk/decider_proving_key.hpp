@@ -20,6 +20,7 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_zk_flavor.hpp"
 #include "barretenberg/trace_to_polynomials/trace_to_polynomials.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomials_cache.hpp"
 #include <chrono>
 
 namespace bb {
@@ -60,9 +61,14 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
 
+    /**
+     * @param precomputed If provided, the precomputed polynomials of this circuit (e.g. from a
+     * PrecomputedPolynomialsCache), which are then copied instead of being recomputed from the circuit.
+     */
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
-                       std::shared_ptr<CommitmentKey> commitment_key = nullptr)
+                       std::shared_ptr<CommitmentKey> commitment_key = nullptr,
+                       std::shared_ptr<const PrecomputedPolynomials<Flavor>> precomputed = nullptr)
         : is_structured(trace_settings.structure.has_value())
     {
         PROFILE_THIS_NAME("DeciderProvingKey(Circuit&)");
@@ -131,9 +137,15 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
             proving_key.polynomials.set_shifted(); // Ensure shifted wires are set correctly
         }
 
+        if (precomputed) {
+            PROFILE_THIS_NAME("copying cached precomputed polynomials");
+
+            precomputed->copy_to(proving_key.polynomials, dyadic_circuit_size);
+        }
+
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         vinfo("populating trace...");
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*compute_precomputed=*/precomputed == nullptr);
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -145,11 +157,11 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                 construct_databus_polynomials(circuit);
             }
         }
-        // Set the lagrange polynomials
-        proving_key.polynomials.lagrange_first.at(0) = 1;
-        proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
+        if (!precomputed) {
+            // Set the lagrange polynomials
+            proving_key.polynomials.lagrange_first.at(0) = 1;
+            proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
 
-        {
             PROFILE_THIS_NAME("constructing lookup table polynomials");
 
             construct_lookup_table_polynomials<Flavor>(
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief The witness-independent (precomputed) polynomials of a proving key: selectors, sigmas/ids (which encode the
+ * copy cycles), lookup tables and Lagrange polynomials.
+ */
+template <typename Flavor> class PrecomputedPolynomials {
+    using Polynomial = typename Flavor::Polynomial;
+
+  public:
+    PrecomputedPolynomials(typename Flavor::ProverPolynomials& polynomials, size_t dyadic_circuit_size)
+        : dyadic_circuit_size(dyadic_circuit_size)
+    {
+        for (auto& polynomial : polynomials.get_precomputed()) {
+            this->polynomials.emplace_back(polynomial);
+        }
+    }
+
+    /**
+     * @brief Copy the cached polynomials into a freshly allocated proving key for the same circuit.
+     * @note Polynomials are deep copied: provers (e.g. folding) modify the polynomials of their key in place.
+     */
+    void copy_to(typename Flavor::ProverPolynomials& target, size_t target_dyadic_circuit_size) const
+    {
+        BB_ASSERT_EQ(target_dyadic_circuit_size, dyadic_circuit_size, "Cached precomputed polynomials size mismatch.");
+        for (auto [target_polynomial, polynomial] : zip_view(target.get_precomputed(), polynomials)) {
+            target_polynomial = polynomial;
+        }
+    }
+
+  private:
+    std::vector<Polynomial> polynomials; // in the order of get_precomputed()
+    size_t dyadic_circuit_size;
+};
+
+/**
+ * @brief A cache of the precomputed polynomials of the circuits we prove, keyed by verification key hash.
+ * @details Proving the same circuit over and over with different witnesses recomputes the same selectors,
+ * permutation polynomials and tables every time. Since the verification key commits to all of them (and to the circuit
+ * size and public inputs layout), its hash identifies them. Entries are evicted in least recently used order. This is
+ * thread safe.
+ */
+template <typename Flavor> class PrecomputedPolynomialsCache {
+  public:
+    using Entry = std::shared_ptr<const PrecomputedPolynomials<Flavor>>;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    PrecomputedPolynomialsCache(size_t capacity = 16)
+        : capacity(capacity)
+    {}
+
+    /**
+     * @brief Get the precomputed polynomials for the circuit with the given verification key hash, if cached.
+     */
+    Entry find(const uint256_t& vk_hash)
+    {
+        std::lock_guard lock(mutex);
+        auto it = entries.find(vk_hash);
+        if (it == entries.end()) {
+            stats.misses++;
+            return nullptr;
+        }
+        stats.hits++;
+        lru.splice(lru.begin(), lru, it->second.second);
+        return it->second.first;
+    }
+
+    void insert(const uint256_t& vk_hash, Entry entry)
+    {
+        std::lock_guard lock(mutex);
+        if (capacity == 0 || entries.contains(vk_hash)) {
+            return;
+        }
+        if (entries.size() == capacity) {
+            entries.erase(lru.back());
+            lru.pop_back();
+        }
+        lru.push_front(vk_hash);
+        entries.emplace(vk_hash, std::make_pair(std::move(entry), lru.begin()));
+    }
+
+    size_t size()
+    {
+        std::lock_guard lock(mutex);
+        return entries.size();
+    }
+
+    /**
+     * @brief The number of lookups (calls to find) that found, or did not find, the circuit in the cache.
+     */
+    Stats get_stats()
+    {
+        std::lock_guard lock(mutex);
+        return stats;
+    }
+
+  private:
+    size_t capacity;
+    std::mutex mutex;
+    Stats stats;
+    // Most recently used first.
+    std::list<uint256_t> lru;
+    std::map<uint256_t, std::pair<Entry, std::list<uint256_t>::iterator>> entries;
+};
+
+} // namespace bb
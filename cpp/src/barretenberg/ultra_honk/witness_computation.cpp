@@ -5,7 +5,9 @@
 // =====================
 
 #include "barretenberg/ultra_honk/witness_computation.hpp"
+#include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ext/starknet/stdlib_circuit_builders/ultra_starknet_flavor.hpp"
 #include "barretenberg/ext/starknet/stdlib_circuit_builders/ultra_starknet_zk_flavor.hpp"
 #include "barretenberg/honk/library/grand_product_delta.hpp"
@@ -20,8 +22,38 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_zk_flavor.hpp"
 
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
 namespace bb {
 
+namespace {
+/**
+ * @brief Montgomery batch inversion of (nonzero) field elements scattered across several polynomials, so that a single
+ * field inversion is performed for all of them.
+ */
+template <typename FF> void batch_invert_entries(std::span<FF* const> entries)
+{
+    if (entries.empty()) {
+        return;
+    }
+    std::vector<FF> products(entries.size());
+    FF accumulator = FF::one();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        products[i] = accumulator;
+        accumulator *= *entries[i];
+    }
+    accumulator = accumulator.invert();
+    for (size_t i = entries.size(); i-- > 0;) {
+        const FF inverse = accumulator * products[i];
+        accumulator *= *entries[i];
+        *entries[i] = inverse;
+    }
+}
+} // namespace
+
 /**
  * @brief Add RAM/ROM memory records to the fourth wire polynomial
  *
@@ -37,25 +69,27 @@ void WitnessComputation<Flavor>::add_ram_rom_memory_records_to_wire_4(typename F
                                                                       const typename Flavor::FF& eta_two,
                                                                       const typename Flavor::FF& eta_three)
 {
+    PROFILE_THIS_NAME("add_ram_rom_memory_records_to_wire_4");
     // The memory record values are computed at the indicated indices as
     // w4 = w3 * eta^3 + w2 * eta^2 + w1 * eta + read_write_flag;
     // (See the Auxiliary relation for details)
     auto wires = proving_key.polynomials.get_wires();
-
-    // Compute read record values
-    for (const auto& gate_idx : proving_key.memory_read_records) {
-        wires[3].at(gate_idx) += wires[2][gate_idx] * eta_three;
-        wires[3].at(gate_idx) += wires[1][gate_idx] * eta_two;
-        wires[3].at(gate_idx) += wires[0][gate_idx] * eta;
-    }
-
-    // Compute write record values
-    for (const auto& gate_idx : proving_key.memory_write_records) {
-        wires[3].at(gate_idx) += wires[2][gate_idx] * eta_three;
-        wires[3].at(gate_idx) += wires[1][gate_idx] * eta_two;
-        wires[3].at(gate_idx) += wires[0][gate_idx] * eta;
-        wires[3].at(gate_idx) += 1;
-    }
+    const auto& read_records = proving_key.memory_read_records;
+    const auto& write_records = proving_key.memory_write_records;
+
+    // Each record is at a distinct gate, so reads and writes are processed together in parallel
+    parallel_for_heuristic(
+        read_records.size() + write_records.size(),
+        [&](size_t i) {
+            const bool is_write = i >= read_records.size();
+            const size_t gate_idx = is_write ? write_records[i - read_records.size()] : read_records[i];
+            FF record = wires[2][gate_idx] * eta_three + wires[1][gate_idx] * eta_two + wires[0][gate_idx] * eta;
+            if (is_write) {
+                record += 1;
+            }
+            wires[3].at(gate_idx) += record;
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 3 + thread_heuristics::FF_ADDITION_COST * 4);
 }
 
 /**
@@ -71,23 +105,50 @@ void WitnessComputation<Flavor>::compute_logderivative_inverses(Flavor::ProvingK
 {
     PROFILE_THIS_NAME("compute_logderivative_inverses");
 
-    // Compute inverses for conventional lookups
-    LogDerivLookupRelation<FF>::compute_logderivative_inverse(
-        proving_key.polynomials, relation_parameters, proving_key.circuit_size);
+    auto& polynomials = proving_key.polynomials;
 
+    // The inverse polynomials of the conventional lookups and, if present, of the calldata, secondary_calldata and
+    // return data reads. Inverses are only ever nonzero within the region over which each polynomial is allocated.
+    constexpr size_t NUM_INVERSES = HasDataBus<Flavor> ? 4 : 1;
+    std::array<typename Flavor::Polynomial*, NUM_INVERSES> inverses;
+    inverses[0] = &polynomials.lookup_inverses;
     if constexpr (HasDataBus<Flavor>) {
-        // Compute inverses for calldata reads
-        DatabusLookupRelation<FF>::template compute_logderivative_inverse</*bus_idx=*/0>(
-            proving_key.polynomials, relation_parameters, proving_key.circuit_size);
-
-        // Compute inverses for secondary_calldata reads
-        DatabusLookupRelation<FF>::template compute_logderivative_inverse</*bus_idx=*/1>(
-            proving_key.polynomials, relation_parameters, proving_key.circuit_size);
-
-        // Compute inverses for return data reads
-        DatabusLookupRelation<FF>::template compute_logderivative_inverse</*bus_idx=*/2>(
-            proving_key.polynomials, relation_parameters, proving_key.circuit_size);
+        inverses[1] = &polynomials.calldata_inverses;
+        inverses[2] = &polynomials.secondary_calldata_inverses;
+        inverses[3] = &polynomials.return_data_inverses;
+    }
+    // The inverse polynomial regions are laid end to end and the result is split evenly between threads
+    std::array<size_t, NUM_INVERSES + 1> offsets{ 0 };
+    for (size_t k = 0; k < NUM_INVERSES; ++k) {
+        offsets[k + 1] = offsets[k] + inverses[k]->size();
     }
+    const MultithreadData thread_data = calculate_thread_data(offsets[NUM_INVERSES]);
+
+    parallel_for(thread_data.num_threads, [&](size_t thread_idx) {
+        // The (nonzero) entries computed by this thread across all the inverse polynomials
+        std::vector<FF*> entries;
+        constexpr_for<0, NUM_INVERSES, 1>([&]<size_t k>() {
+            auto& inverse = *inverses[k];
+            const size_t start = std::max(thread_data.start[thread_idx], offsets[k]);
+            const size_t end = std::min(thread_data.end[thread_idx], offsets[k + 1]);
+            for (size_t j = start; j < end; ++j) {
+                const size_t i = inverse.start_index() + j - offsets[k];
+                FF value;
+                if constexpr (k == 0) {
+                    value =
+                        LogDerivLookupRelation<FF>::compute_inverse_denominator(polynomials, relation_parameters, i);
+                } else {
+                    value = DatabusLookupRelation<FF>::template compute_inverse_denominator<k - 1>(
+                        polynomials, relation_parameters, i);
+                }
+                if (!value.is_zero()) {
+                    inverse.at(i) = value;
+                    entries.push_back(&inverse.at(i));
+                }
+            }
+        });
+        batch_invert_entries<FF>(entries);
+    });
 }
 
 /**
@@ -3,6 +3,7 @@
 #include "barretenberg/vm2/proving_helper.hpp"
 #include "barretenberg/vm2/simulation_helper.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
 #include "barretenberg/vm2/tracegen_helper.hpp"
 
 namespace bb::avm2 {
@@ -11,6 +12,11 @@ using namespace bb::avm2::simulation;
 
 std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmAPI::ProvingInputs& inputs)
 {
+    // The columns that do not depend on the simulation are generated while we simulate.
+    AvmTraceGenHelper tracegen_helper;
+    tracegen::TraceContainer trace;
+    auto event_independent_columns = tracegen_helper.start_event_independent_columns(trace, inputs.publicInputs);
+
     // Simulate.
     info("Simulating...");
     AvmSimulationHelper simulation_helper(inputs.hints);
@@ -18,9 +24,8 @@ std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmA
 
     // Generate trace.
     info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
-    auto trace =
-        AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), inputs.publicInputs));
+    AVM_TRACK_TIME("tracegen/all",
+                   tracegen_helper.finish_trace(std::move(events), trace, std::move(event_independent_columns)));
 
     // Prove.
     info("Proving...");
@@ -33,6 +38,11 @@ std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmA
 
 bool AvmAPI::check_circuit(const AvmAPI::ProvingInputs& inputs)
 {
+    // The columns that do not depend on the simulation are generated while we simulate.
+    AvmTraceGenHelper tracegen_helper;
+    tracegen::TraceContainer trace;
+    auto event_independent_columns = tracegen_helper.start_event_independent_columns(trace, inputs.publicInputs);
+
     // Simulate.
     info("Simulating...");
     AvmSimulationHelper simulation_helper(inputs.hints);
@@ -40,9 +50,8 @@ bool AvmAPI::check_circuit(const AvmAPI::ProvingInputs& inputs)
 
     // Generate trace.
     info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
-    auto trace =
-        AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), inputs.publicInputs));
+    AVM_TRACK_TIME("tracegen/all",
+                   tracegen_helper.finish_trace(std::move(events), trace, std::move(event_independent_columns)));
 
     // Check circuit.
     info("Checking circuit...");
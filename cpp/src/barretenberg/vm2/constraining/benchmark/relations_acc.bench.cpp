@@ -3,9 +3,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/constraining/flavor.hpp"
 #include "barretenberg/vm2/constraining/full_row.hpp"
@@ -76,6 +79,75 @@ template <typename Relation> void BM_accumulate_interactions(State& state)
     });
 }
 
+// The interactions (lookups and permutations) that belong to a main relation.
+template <typename Relation, size_t... Is> auto filter_interactions(std::index_sequence<Is...>)
+{
+    using AllInteractions = typename AvmFlavor::LookupRelations;
+    return std::tuple_cat(
+        std::conditional_t<Relation::NAME == std::tuple_element_t<Is, AllInteractions>::RELATION_NAME,
+                           std::tuple<std::tuple_element_t<Is, AllInteractions>>,
+                           std::tuple<>>{}...);
+}
+template <typename Relation>
+using InteractionsOf = decltype(filter_interactions<Relation>(
+    std::make_index_sequence<std::tuple_size_v<typename AvmFlavor::LookupRelations>>{}));
+
+template <typename Tuple> struct AccumulatorsOf;
+template <typename... Rs> struct AccumulatorsOf<std::tuple<Rs...>> {
+    using type = std::tuple<typename Rs::SumcheckArrayOfValuesOverSubrelations...>;
+};
+
+// Accumulates like sumcheck does, i.e., skipping the relation if its skip predicate allows it.
+template <typename Relation>
+void accumulate_or_skip(typename Relation::SumcheckArrayOfValuesOverSubrelations& result,
+                        const AvmFullRow& row,
+                        const bb::RelationParameters<FF>& params,
+                        const FF& scaling_factor)
+{
+    if constexpr (bb::isSkippable<Relation, AvmFullRow>) {
+        if (Relation::skip(row)) {
+            return;
+        }
+    }
+    Relation::accumulate(result, row, params, scaling_factor);
+}
+
+constexpr size_t NUM_GROUP_ROWS = 64;
+
+// Time to accumulate a relation together with its interactions over a batch of rows, of which only the given
+// percentage is active. The other rows are zero, so relations gated on a selector skip them.
+template <typename Relation> void BM_accumulate_group(State& state)
+{
+    using Interactions = InteractionsOf<Relation>;
+    const auto active_percent = static_cast<size_t>(state.range(0));
+
+    AvmFullRow zero_row;
+    for (size_t i = 0; i < NUM_COLUMNS_WITH_SHIFTS; i++) {
+        zero_row.get(static_cast<ColumnAndShifts>(i)) = 0;
+    }
+    std::vector<AvmFullRow> rows;
+    rows.reserve(NUM_GROUP_ROWS);
+    for (size_t i = 0; i < NUM_GROUP_ROWS; i++) {
+        rows.push_back(i * 100 < active_percent * NUM_GROUP_ROWS ? get_random_row() : zero_row);
+    }
+    auto params = get_params();
+    FF scaling_factor = 1;
+
+    typename Relation::SumcheckArrayOfValuesOverSubrelations result{};
+    typename AccumulatorsOf<Interactions>::type interaction_results{};
+
+    for (auto _ : state) {
+        for (const auto& row : rows) {
+            accumulate_or_skip<Relation>(result, row, params, scaling_factor);
+            bb::constexpr_for<0, std::tuple_size_v<Interactions>, 1>([&]<size_t i>() {
+                using Interaction = std::tuple_element_t<i, Interactions>;
+                accumulate_or_skip<Interaction>(std::get<i>(interaction_results), row, params, scaling_factor);
+            });
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_GROUP_ROWS));
+}
+
 } // namespace
 
 int main(int argc, char** argv)
@@ -88,6 +160,13 @@ int main(int argc, char** argv)
                 ->Name(std::string(Relation::NAME) + "_interactions_acc")
                 ->Unit(kMicrosecond);
         }
+        BENCHMARK(BM_accumulate_group<Relation>)
+            ->Name(std::string(Relation::NAME) + "_group_acc")
+            ->ArgName("active_percent")
+            ->Arg(0)
+            ->Arg(10)
+            ->Arg(100)
+            ->Unit(kMicrosecond);
     });
 
     ::benchmark::Initialize(&argc, argv);
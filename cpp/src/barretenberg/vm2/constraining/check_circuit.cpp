@@ -1,20 +1,153 @@
 #include "barretenberg/vm2/constraining/check_circuit.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <span>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/utils.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/relation_types.hpp"
+#include "barretenberg/vm2/common/stringify.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 
 namespace bb::avm2::constraining {
+namespace {
 
-void run_check_circuit(AvmFlavor::ProverPolynomials& polys, size_t num_rows)
+// The first failure of a relation. Chunks are checked out of order, so we keep the one at the lowest row.
+class RelationFailure {
+  public:
+    // Whether a failure was already found at or before the given row, in which case there is no need to keep checking.
+    bool found_before(size_t row) const { return first_row.load(std::memory_order_relaxed) <= row; }
+
+    void record(size_t row, std::string&& failure_message)
+    {
+        std::lock_guard lock(mutex);
+        if (row < first_row.load(std::memory_order_relaxed)) {
+            message = std::move(failure_message);
+            first_row.store(row, std::memory_order_relaxed);
+        }
+    }
+    bool failed() const { return !message.empty(); }
+    const std::string& get_message() const { return message; }
+
+  private:
+    std::atomic<size_t> first_row = std::numeric_limits<size_t>::max();
+    std::mutex mutex;
+    std::string message;
+};
+
+// The accumulated value of a lookup/permutation relation, summed over all the chunks.
+template <typename Relation> struct LookupTotal {
+    std::mutex mutex;
+    typename Relation::SumcheckArrayOfValuesOverSubrelations result{};
+};
+
+bool should_check(std::string_view relation_name, const std::vector<std::string>& only_relations)
+{
+    return only_relations.empty() ||
+           std::find(only_relations.begin(), only_relations.end(), relation_name) != only_relations.end();
+}
+
+struct TupleHash {
+    template <size_t SIZE> size_t operator()(const std::array<AvmFlavor::FF, SIZE>& tuple) const
+    {
+        return [&tuple]<size_t... Is>(std::index_sequence<Is...>) {
+            return bb::utils::hash_as_tuple(tuple[Is]...);
+        }(std::make_index_sequence<SIZE>{});
+    }
+};
+
+template <size_t SIZE>
+std::string tuple_to_string(const std::array<ColumnAndShifts, SIZE>& columns,
+                            const std::array<AvmFlavor::FF, SIZE>& tuple)
+{
+    std::string result = "(";
+    for (size_t i = 0; i < SIZE; ++i) {
+        result += format(
+            i == 0 ? "" : ", ", COLUMN_NAMES[static_cast<size_t>(columns[i])], "=", field_to_string(tuple[i]));
+    }
+    return result + ")";
+}
+
+// The lookup sum only tells us that a lookup failed somewhere. This finds where: the first source row whose tuple is
+// not in the destination or, if there is none, the first destination row whose counts do not match the lookups.
+template <typename Settings>
+std::string describe_lookup_failure(const AvmFlavor::ProverPolynomials& polys, size_t num_rows)
+{
+    using FF = AvmFlavor::FF;
+    using Tuple = std::array<FF, Settings::LOOKUP_TUPLE_SIZE>;
+    const auto get_tuple = [&polys](const auto& columns, size_t row) {
+        Tuple tuple;
+        for (size_t i = 0; i < tuple.size(); ++i) {
+            tuple[i] = polys.get(columns[i])[row];
+        }
+        return tuple;
+    };
+    const auto& src_selector = polys.get(static_cast<ColumnAndShifts>(Settings::SRC_SELECTOR));
+    const auto& dst_selector = polys.get(static_cast<ColumnAndShifts>(Settings::DST_SELECTOR));
+    const auto& counts = polys.get(static_cast<ColumnAndShifts>(Settings::COUNTS));
+
+    // For every destination tuple: the sum of its counts, and the number of times it is looked up.
+    std::unordered_map<Tuple, std::pair<FF, FF>, TupleHash> tally;
+    for (size_t r = 0; r < num_rows; ++r) {
+        if (dst_selector[r] == FF(1)) {
+            tally[get_tuple(Settings::DST_COLUMNS, r)].first += counts[r];
+        }
+    }
+    for (size_t r = 0; r < num_rows; ++r) {
+        if (src_selector[r] == FF(1)) {
+            const auto tuple = get_tuple(Settings::SRC_COLUMNS, r);
+            auto it = tally.find(tuple);
+            if (it == tally.end()) {
+                return format("tuple ",
+                              tuple_to_string(Settings::SRC_COLUMNS, tuple),
+                              " at row ",
+                              r,
+                              " is not in the destination ",
+                              COLUMN_NAMES[static_cast<size_t>(Settings::DST_SELECTOR)]);
+            }
+            it->second.second += 1;
+        }
+    }
+    for (size_t r = 0; r < num_rows; ++r) {
+        if (dst_selector[r] == FF(1)) {
+            const auto tuple = get_tuple(Settings::DST_COLUMNS, r);
+            const auto& [total_counts, num_lookups] = tally.at(tuple);
+            if (total_counts != num_lookups) {
+                return format("counts of destination tuple ",
+                              tuple_to_string(Settings::DST_COLUMNS, tuple),
+                              " (first at row ",
+                              r,
+                              ") add up to ",
+                              field_to_string(total_counts),
+                              " but it is looked up ",
+                              field_to_string(num_lookups),
+                              " times");
+            }
+        }
+    }
+    return "source and destination tuples match, check the selectors";
+}
+
+} // namespace
+
+void run_check_circuit(AvmFlavor::ProverPolynomials& polys,
+                       size_t num_rows,
+                       const std::vector<std::string>& only_relations)
 {
     bb::RelationParameters<AvmFlavor::FF> params = {
         .eta = 0,
@@ -27,53 +160,125 @@ void run_check_circuit(AvmFlavor::ProverPolynomials& polys, size_t num_rows)
         .eccvm_set_permutation_delta = 0,
     };
 
-    // Checks that we will run.
+    const size_t num_chunks = (num_rows + CHECK_CIRCUIT_ROWS_PER_CHUNK - 1) / CHECK_CIRCUIT_ROWS_PER_CHUNK;
+    constexpr size_t NUM_MAIN_RELATIONS = std::tuple_size_v<typename AvmFlavor::MainRelations>;
+    constexpr size_t NUM_LOOKUP_RELATIONS = std::tuple_size_v<typename AvmFlavor::LookupRelations>;
+
+    // Failures, in the order of the relations in the flavor (main relations first).
+    std::vector<RelationFailure> failures(NUM_MAIN_RELATIONS + NUM_LOOKUP_RELATIONS);
+
+    // Computation of the logderivative inverses, which must be done before checking the lookups.
+    std::vector<std::function<void()>> inverse_jobs;
+    // Checks that we will run, one per relation and chunk of rows.
     std::vector<std::function<void()>> checks;
+    // Run after all the checks, to verify the lookup sums over all rows.
+    std::vector<std::function<void()>> lookup_finalizers;
 
     // Add relation checks.
-    bb::constexpr_for<0, std::tuple_size_v<typename AvmFlavor::MainRelations>, 1>([&]<size_t i>() {
+    bb::constexpr_for<0, NUM_MAIN_RELATIONS, 1>([&]<size_t i>() {
         using Relation = std::tuple_element_t<i, typename AvmFlavor::MainRelations>;
-        checks.push_back([&]() {
-            typename Relation::SumcheckArrayOfValuesOverSubrelations result{};
-
-            for (size_t r = 0; r < num_rows; ++r) {
-                Relation::accumulate(result, polys.get_row(r), {}, 1);
-                for (size_t j = 0; j < result.size(); ++j) {
-                    if (!result[j].is_zero()) {
-                        throw std::runtime_error(format("Relation ",
-                                                        Relation::NAME,
-                                                        ", subrelation ",
-                                                        Relation::get_subrelation_label(j),
-                                                        " failed at row ",
-                                                        r));
+        if (!should_check(Relation::NAME, only_relations)) {
+            return;
+        }
+        RelationFailure& failure = failures[i];
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const size_t start = chunk * CHECK_CIRCUIT_ROWS_PER_CHUNK;
+            const size_t end = std::min(start + CHECK_CIRCUIT_ROWS_PER_CHUNK, num_rows);
+            checks.push_back([&polys, &failure, start, end]() {
+                for (size_t r = start; r < end && !failure.found_before(r); ++r) {
+                    const auto row = polys.get_row(r);
+                    if constexpr (bb::isSkippable<Relation, std::decay_t<decltype(row)>>) {
+                        if (Relation::skip(row)) {
+                            continue;
+                        }
+                    }
+                    typename Relation::SumcheckArrayOfValuesOverSubrelations result{};
+                    Relation::accumulate(result, row, {}, 1);
+                    for (size_t j = 0; j < result.size(); ++j) {
+                        if (!result[j].is_zero()) {
+                            failure.record(r,
+                                           format("Relation ",
+                                                  Relation::NAME,
+                                                  ", subrelation ",
+                                                  Relation::get_subrelation_label(j),
+                                                  " failed at row ",
+                                                  r));
+                            return;
+                        }
                     }
                 }
-            }
-        });
+            });
+        }
     });
 
     // Add calculation of logderivatives and lookup/permutation checks.
-    bb::constexpr_for<0, std::tuple_size_v<typename AvmFlavor::LookupRelations>, 1>([&]<size_t i>() {
+    // The logderivative relation only holds over the sum of all rows, so every chunk adds its partial sum to a total.
+    bb::constexpr_for<0, NUM_LOOKUP_RELATIONS, 1>([&]<size_t i>() {
         using Relation = std::tuple_element_t<i, typename AvmFlavor::LookupRelations>;
-        checks.push_back([&, num_rows]() {
-            // Compute logderivs.
+        if (!should_check(Relation::RELATION_NAME, only_relations)) {
+            return;
+        }
+        RelationFailure& failure = failures[NUM_MAIN_RELATIONS + i];
+        inverse_jobs.push_back([&polys, &params, num_rows]() {
             bb::compute_logderivative_inverse<typename AvmFlavor::FF, Relation>(polys, params, num_rows);
+        });
 
-            // Check the logderivative relation
-            typename Relation::SumcheckArrayOfValuesOverSubrelations lookup_result{};
-            for (size_t r = 0; r < num_rows; ++r) {
-                Relation::accumulate(lookup_result, polys.get_row(r), params, 1);
-            }
-            for (auto r : lookup_result) {
-                if (!r.is_zero()) {
-                    throw std::runtime_error(format("Lookup ", Relation::NAME, " failed."));
+        auto total = std::make_shared<LookupTotal<Relation>>();
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const size_t start = chunk * CHECK_CIRCUIT_ROWS_PER_CHUNK;
+            const size_t end = std::min(start + CHECK_CIRCUIT_ROWS_PER_CHUNK, num_rows);
+            checks.push_back([&polys, &params, &failure, total, start, end]() {
+                typename Relation::SumcheckArrayOfValuesOverSubrelations lookup_result{};
+                for (size_t r = start; r < end; ++r) {
+                    Relation::accumulate(lookup_result, polys.get_row(r), params, 1);
+                    // The inverse subrelation must hold at every row.
+                    if (!lookup_result[0].is_zero() && !failure.found_before(r)) {
+                        failure.record(r,
+                                       format("Lookup ",
+                                              Relation::NAME,
+                                              ", subrelation ",
+                                              Relation::get_subrelation_label(0),
+                                              " failed at row ",
+                                              r));
+                    }
+                    lookup_result[0] = 0;
+                }
+                std::lock_guard lock(total->mutex);
+                for (size_t j = 0; j < lookup_result.size(); ++j) {
+                    total->result[j] += lookup_result[j];
                 }
+            });
+        }
+        lookup_finalizers.push_back([&polys, &failure, total, num_rows]() {
+            if (!failure.failed() && !total->result[1].is_zero()) {
+                failure.record(0,
+                               format("Lookup ",
+                                      Relation::NAME,
+                                      " failed: ",
+                                      describe_lookup_failure<typename Relation::Settings>(polys, num_rows)));
             }
         });
     });
 
-    // Do it!
+    // Do it! These are separate parallel_for calls because they cannot be nested.
+    bb::parallel_for(inverse_jobs.size(), [&](size_t i) { inverse_jobs[i](); });
     bb::parallel_for(checks.size(), [&](size_t i) { checks[i](); });
+    for (auto& finalize : lookup_finalizers) {
+        finalize();
+    }
+
+    // Report all the failures at once.
+    std::string report;
+    size_t num_failures = 0;
+    for (const auto& failure : failures) {
+        if (failure.failed()) {
+            report += "\n" + failure.get_message();
+            num_failures++;
+        }
+    }
+    if (num_failures > 0) {
+        throw std::runtime_error(format(num_failures, " relation(s) failed:", report));
+    }
 }
 
 } // namespace bb::avm2::constraining
@@ -1,13 +1,27 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include "barretenberg/vm2/constraining/flavor.hpp"
 
 namespace bb::avm2::constraining {
 
+// Rows are split in chunks of this size, and every (relation, chunk) pair is a separate job.
+constexpr size_t CHECK_CIRCUIT_ROWS_PER_CHUNK = 1 << 12;
+
 // This is a version of check circuit that runs on the prover polynomials.
 // It is the closest to "real proving" that we can get without actually running the prover.
-void run_check_circuit(AvmFlavor::ProverPolynomials& polys, size_t num_rows);
+//
+// Rows are checked in chunks, in parallel, and every relation stops at its first failing row. All the failing
+// relations are reported together in a single std::runtime_error, thrown from the calling thread. A failing lookup is
+// reported with the first row whose tuple is not in the destination, or whose counts are wrong.
+// If only_relations is not empty, only the given relations (e.g., "alu", "memory") and the lookups and permutations
+// they own are checked. This is useful to iterate quickly on a subtrace.
+void run_check_circuit(AvmFlavor::ProverPolynomials& polys,
+                       size_t num_rows,
+                       const std::vector<std::string>& only_relations = {});
 
 } // namespace bb::avm2::constraining
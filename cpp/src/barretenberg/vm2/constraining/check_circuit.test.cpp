@@ -0,0 +1,159 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/constraining/check_circuit.hpp"
+#include "barretenberg/vm2/constraining/polynomials.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/generated/relations/lookups_ff_gt.hpp"
+#include "barretenberg/vm2/proving_helper.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_builder.hpp"
+#include "barretenberg/vm2/tracegen/test_trace_container.hpp"
+
+namespace bb::avm2::constraining {
+namespace {
+
+using ::testing::HasSubstr;
+using ::testing::Not;
+using tracegen::TestTraceContainer;
+using C = Column;
+using lookup_a_lo_range = lookup_ff_gt_a_lo_range_relation<FF>;
+using lookup_a_hi_range = lookup_ff_gt_a_hi_range_relation<FF>;
+
+constexpr uint32_t CHUNK = static_cast<uint32_t>(CHECK_CIRCUIT_ROWS_PER_CHUNK);
+
+// Runs the check and returns the failure report, or an empty string if all the relations hold.
+std::string check(TestTraceContainer& trace, const std::vector<std::string>& only_relations)
+{
+    const size_t num_rows = trace.get_num_rows() + 1;
+    auto polys = compute_polynomials(trace);
+    try {
+        run_check_circuit(polys, num_rows, only_relations);
+    } catch (const std::runtime_error& e) {
+        return e.what();
+    }
+    return "";
+}
+
+// ALU_ADD (ia + ib = ic) is not gated on a selector, so it fails on any row where this does not hold.
+void break_alu(TestTraceContainer& trace, uint32_t row)
+{
+    trace.set(C::alu_ia, row, 1);
+}
+
+// A memory row where rw is not boolean.
+void break_memory(TestTraceContainer& trace, uint32_t row)
+{
+    trace.set(C::memory_sel, row, 1);
+    trace.set(C::memory_rw, row, 2);
+}
+
+TEST(AvmCheckCircuitTest, FirstFailingRowAcrossChunks)
+{
+    TestTraceContainer trace;
+    // Failures in chunks 2 and 1. Chunks are checked in parallel, but the lowest row is reported.
+    break_alu(trace, (2 * CHUNK) + 1);
+    break_alu(trace, CHUNK + 5);
+
+    const std::string report = check(trace, { "alu" });
+    EXPECT_THAT(report, HasSubstr("1 relation(s) failed"));
+    EXPECT_THAT(report, HasSubstr(format("Relation alu, subrelation ALU_ADD failed at row ", CHUNK + 5)));
+    EXPECT_THAT(report, Not(HasSubstr(format("row ", (2 * CHUNK) + 1))));
+}
+
+TEST(AvmCheckCircuitTest, ReportsAllFailingRelations)
+{
+    TestTraceContainer trace;
+    break_memory(trace, 3);
+    break_alu(trace, (3 * CHUNK) + 7);
+
+    const std::string report = check(trace, { "alu", "memory" });
+    EXPECT_THAT(report, HasSubstr("2 relation(s) failed"));
+    EXPECT_THAT(report, HasSubstr(format("Relation alu, subrelation ALU_ADD failed at row ", (3 * CHUNK) + 7)));
+    EXPECT_THAT(report, HasSubstr("Relation memory"));
+    EXPECT_THAT(report, HasSubstr("failed at row 3"));
+}
+
+TEST(AvmCheckCircuitTest, OnlyChecksTheGivenRelations)
+{
+    TestTraceContainer trace;
+    break_alu(trace, 10);
+    break_memory(trace, 20);
+
+    const std::string report = check(trace, { "memory" });
+    EXPECT_THAT(report, HasSubstr("Relation memory"));
+    EXPECT_THAT(report, Not(HasSubstr("alu")));
+
+    TestTraceContainer alu_trace;
+    break_alu(alu_trace, 10);
+    EXPECT_EQ(check(alu_trace, { "memory" }), "");
+    EXPECT_THAT(check(alu_trace, { "alu" }), HasSubstr("Relation alu"));
+}
+
+TEST(AvmCheckCircuitTest, RelationsFromEnvironment)
+{
+    TestTraceContainer trace;
+    break_alu(trace, 10);
+
+    AvmProvingHelper prover;
+    setenv("AVM_CHECK_CIRCUIT_RELATIONS", "memory", 1);
+    EXPECT_TRUE(prover.check_circuit(TestTraceContainer(trace)));
+    setenv("AVM_CHECK_CIRCUIT_RELATIONS", "memory,alu", 1);
+    EXPECT_FALSE(prover.check_circuit(TestTraceContainer(trace)));
+    unsetenv("AVM_CHECK_CIRCUIT_RELATIONS");
+}
+
+// Values 0..NUM_VALUES-1 in the range check destination, each looked up once through a_lo and a_hi.
+constexpr uint32_t NUM_VALUES = 100;
+
+TestTraceContainer make_lookup_trace()
+{
+    TestTraceContainer trace;
+    for (uint32_t value = 0; value < NUM_VALUES; ++value) {
+        const uint32_t row = 1 + value;
+        trace.set(C::range_check_sel, row, 1);
+        trace.set(C::range_check_value, row, value);
+        trace.set(C::range_check_rng_chk_bits, row, 128);
+
+        trace.set(C::ff_gt_sel, row, 1);
+        trace.set(C::ff_gt_a_lo, row, value);
+        trace.set(C::ff_gt_a_hi, row, value);
+        trace.set(C::ff_gt_constant_128, row, 128);
+    }
+    tracegen::LookupIntoDynamicTableGeneric<lookup_a_lo_range::Settings>().process(trace);
+    tracegen::LookupIntoDynamicTableGeneric<lookup_a_hi_range::Settings>().process(trace);
+    return trace;
+}
+
+TEST(AvmCheckCircuitTest, LookupFailureReportsMissingTuple)
+{
+    TestTraceContainer trace = make_lookup_trace();
+    trace.set(C::ff_gt_a_hi, 42, NUM_VALUES + 7);
+
+    const std::string report = check(trace, { "ff_gt" });
+    EXPECT_THAT(report, HasSubstr("Lookup LOOKUP_FF_GT_A_HI_RANGE failed: tuple (ff_gt_a_hi="));
+    EXPECT_THAT(report, HasSubstr("at row 42 is not in the destination range_check_sel"));
+    EXPECT_THAT(report, Not(HasSubstr("LOOKUP_FF_GT_A_LO_RANGE")));
+}
+
+TEST(AvmCheckCircuitTest, LookupFailureReportsWrongCounts)
+{
+    TestTraceContainer trace = make_lookup_trace();
+    trace.set(lookup_a_lo_range::Settings::COUNTS, 5, 2);
+
+    const std::string report = check(trace, { "ff_gt" });
+    EXPECT_THAT(report,
+                HasSubstr("Lookup LOOKUP_FF_GT_A_LO_RANGE failed: counts of destination tuple (range_check_value="));
+    EXPECT_THAT(report, HasSubstr("(first at row 5) add up to"));
+    EXPECT_THAT(report, Not(HasSubstr("LOOKUP_FF_GT_A_HI_RANGE")));
+}
+
+} // namespace
+} // namespace bb::avm2::constraining
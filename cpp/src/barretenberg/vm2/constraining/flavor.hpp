@@ -14,6 +14,7 @@
 #include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/vm2/constraining/entities.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
+#include "barretenberg/vm2/constraining/lazy_extended_edges.hpp"
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/generated/flavor_variables.hpp"
@@ -312,6 +313,12 @@ class AvmFlavor {
      */
     using ExtendedEdges = ProverUnivariates<MAX_PARTIAL_RELATION_LENGTH>;
 
+    /**
+     * @brief Extended edges that sumcheck only computes for the columns that the active relations read.
+     */
+    template <typename Polynomials>
+    using LazyExtendedEdges = avm2::LazyExtendedEdges<Polynomials, FF, MAX_PARTIAL_RELATION_LENGTH>;
+
     /**
      * @brief A container for the witness commitments.
      *
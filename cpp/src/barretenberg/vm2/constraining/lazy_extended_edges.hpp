@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "barretenberg/polynomials/univariate.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+
+namespace bb::avm2 {
+
+/**
+ * @brief The sumcheck extended edges of all the columns, where a column is only extended when it is first read.
+ *
+ * @details Sumcheck extends every column on every edge before it evaluates the relations. Most AVM relations are gated
+ * on a selector that is zero on most edges, so most relations are skipped and most of those extensions are never read.
+ * With this container, a skipped relation only pays for the columns in its skip condition, and a column that several
+ * relations read is extended once per edge.
+ *
+ * Call set_edge() before reading the columns of an edge. References returned by get() are valid until the next
+ * set_edge().
+ */
+template <typename Polynomials, typename FF, size_t LENGTH> class LazyExtendedEdges {
+  public:
+    using DataType = bb::Univariate<FF, LENGTH>;
+
+    LazyExtendedEdges(const Polynomials& multivariates)
+        : multivariates(multivariates)
+    {}
+
+    void set_edge(size_t edge_idx)
+    {
+        this->edge_idx = edge_idx;
+        // Invalidates every column extended for the previous edge.
+        current_stamp++;
+    }
+
+    const DataType& get(ColumnAndShifts c) const
+    {
+        const auto col = static_cast<size_t>(c);
+        if (stamps[col] != current_stamp) {
+            extend(col, multivariates.get(c));
+            stamps[col] = current_stamp;
+        }
+        return extended[col];
+    }
+
+  private:
+    template <typename Polynomial> void extend(size_t col, const Polynomial& multivariate) const
+    {
+        // Same as SumcheckProverRound::extend_edges, for a single column.
+        if (multivariate.end_index() < edge_idx) {
+            static const auto zero_univariate = DataType::zero();
+            extended[col] = zero_univariate;
+        } else {
+            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+            extended[col] = edge.template extend_to<LENGTH>();
+        }
+    }
+
+    const Polynomials& multivariates;
+    size_t edge_idx = 0;
+    // Stamps start at 0, so nothing is valid before the first set_edge().
+    size_t current_stamp = 0;
+    mutable std::array<size_t, NUM_COLUMNS_WITH_SHIFTS> stamps{};
+    mutable std::array<DataType, NUM_COLUMNS_WITH_SHIFTS> extended;
+};
+
+} // namespace bb::avm2
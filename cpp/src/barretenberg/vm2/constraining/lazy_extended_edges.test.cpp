@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/polynomials/gate_separator.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/constraining/flavor.hpp"
+#include "barretenberg/vm2/constraining/lazy_extended_edges.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+
+namespace bb::avm2::constraining {
+namespace {
+
+using C = ColumnAndShifts;
+using Polynomials = AvmFlavor::PartiallyEvaluatedMultivariates;
+using SumcheckRound = SumcheckProverRound<AvmFlavor>;
+
+constexpr size_t LOG_CIRCUIT_SIZE = 5;
+constexpr size_t CIRCUIT_SIZE = 1 << LOG_CIRCUIT_SIZE;
+constexpr size_t ACTIVE_ROWS = 4;
+
+// Every column is random on the first ACTIVE_ROWS rows and zero afterwards, so that selector-gated relations are active
+// on the first edges and skipped on the others. The execution selector only has backing memory for the active rows.
+Polynomials make_polynomials()
+{
+    Polynomials polys;
+    for (auto& poly : polys.get_all()) {
+        poly = AvmFlavor::Polynomial(CIRCUIT_SIZE);
+        for (size_t i = 0; i < ACTIVE_ROWS; i++) {
+            poly.at(i) = FF::random_element();
+        }
+    }
+    auto& short_poly = polys.get(C::execution_sel);
+    short_poly = AvmFlavor::Polynomial(ACTIVE_ROWS, CIRCUIT_SIZE);
+    for (size_t i = 0; i < ACTIVE_ROWS; i++) {
+        short_poly.at(i) = FF::random_element();
+    }
+    return polys;
+}
+
+TEST(AvmLazyExtendedEdgesTest, ColumnsMatchEagerExtension)
+{
+    const auto polys = make_polynomials();
+    SumcheckRound round(CIRCUIT_SIZE);
+    auto eager = std::make_unique<AvmFlavor::ExtendedEdges>();
+    auto lazy = std::make_unique<AvmFlavor::LazyExtendedEdges<Polynomials>>(polys);
+
+    for (size_t edge_idx = 0; edge_idx < CIRCUIT_SIZE; edge_idx += 2) {
+        round.extend_edges(*eager, polys, edge_idx);
+        lazy->set_edge(edge_idx);
+        for (size_t i = 0; i < NUM_COLUMNS_WITH_SHIFTS; i++) {
+            const auto c = static_cast<ColumnAndShifts>(i);
+            // Read twice: the second read comes from the cache.
+            EXPECT_EQ(lazy->get(c), eager->get(c));
+            EXPECT_EQ(lazy->get(c), eager->get(c));
+        }
+    }
+}
+
+// Sumcheck uses the lazy edges for the AVM and skips inactive relations. The round univariate must be the same as the
+// one obtained by extending every column and accumulating every relation on every edge.
+TEST(AvmLazyExtendedEdgesTest, RoundUnivariateMatchesEagerAccumulation)
+{
+    auto polys = make_polynomials();
+    const auto params = RelationParameters<FF>::get_random();
+    const FF alpha = FF::random_element();
+    std::vector<FF> betas(LOG_CIRCUIT_SIZE);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    const GateSeparatorPolynomial<FF> gate_separators(betas, LOG_CIRCUIT_SIZE);
+
+    SumcheckRound round(CIRCUIT_SIZE);
+    const auto lazy_univariate = round.compute_univariate(polys, params, gate_separators, alpha);
+
+    AvmFlavor::SumcheckTupleOfTuplesOfUnivariates accumulators;
+    RelationUtils<AvmFlavor>::zero_univariates(accumulators);
+    auto extended_edges = std::make_unique<AvmFlavor::ExtendedEdges>();
+    for (size_t edge_idx = 0; edge_idx < CIRCUIT_SIZE; edge_idx += 2) {
+        round.extend_edges(*extended_edges, polys, edge_idx);
+        const FF& scaling_factor = gate_separators[(edge_idx >> 1) * gate_separators.periodicity];
+        constexpr_for<0, AvmFlavor::NUM_RELATIONS, 1>([&]<size_t i>() {
+            using Relation = std::tuple_element_t<i, AvmFlavor::Relations>;
+            Relation::accumulate(std::get<i>(accumulators), *extended_edges, params, scaling_factor);
+        });
+    }
+    const auto eager_univariate = SumcheckRound::batch_over_relations<SumcheckRound::SumcheckRoundUnivariate>(
+        accumulators, alpha, gate_separators);
+
+    EXPECT_EQ(lazy_univariate, eager_univariate);
+}
+
+} // namespace
+} // namespace bb::avm2::constraining
@@ -64,8 +64,8 @@ template <typename FF_, typename Settings_> struct lookup_relation_base : public
 
     template <typename AllEntities> inline static bool skip(const AllEntities& in)
     {
-        auto inverse = std::get<0>(Settings::get_entities(in));
-        return inverse.is_zero();
+        // Only read the inverses, so that a skipped lookup does not touch its other columns.
+        return in.get(static_cast<ColumnAndShifts>(Settings::INVERSES)).is_zero();
     }
 
     static std::string get_subrelation_label(size_t index)
@@ -4,7 +4,10 @@
 #include <cstdlib>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include "barretenberg/common/container.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -36,6 +39,28 @@ std::shared_ptr<AvmProver::ProvingKey> create_proving_key(AvmProver::ProverPolyn
     return proving_key;
 }
 
+// The relations to check, from a comma separated list in AVM_CHECK_CIRCUIT_RELATIONS. Empty means all of them.
+std::vector<std::string> get_relations_to_check()
+{
+    std::vector<std::string> relations;
+    const char* env = getenv("AVM_CHECK_CIRCUIT_RELATIONS");
+    if (env == nullptr) {
+        return relations;
+    }
+    std::string list(env);
+    for (size_t start = 0; start <= list.size();) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        if (end > start) {
+            relations.push_back(list.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return relations;
+}
+
 } // namespace
 
 // Create AvmVerifier::VerificationKey based on VkData and returns shared pointer.
@@ -101,12 +126,16 @@ bool AvmProvingHelper::check_circuit(tracegen::TraceContainer&& trace)
 
     // Warning: this destroys the trace.
     auto polynomials = AVM_TRACK_TIME_V("proving/prove:compute_polynomials", constraining::compute_polynomials(trace));
+    const auto relations_to_check = get_relations_to_check();
+    if (!relations_to_check.empty()) {
+        info("Only checking relations: ", join(relations_to_check, ", "));
+    }
     try {
-        AVM_TRACK_TIME("proving/check_circuit", constraining::run_check_circuit(polynomials, num_rows));
+        AVM_TRACK_TIME("proving/check_circuit",
+                       constraining::run_check_circuit(polynomials, num_rows, relations_to_check));
     } catch (std::runtime_error& e) {
-        // FIXME: This exception is never caught because it's thrown in a different thread.
-        // Execution never gets here!
         info("Circuit check failed: ", e.what());
+        return false;
     }
 
     return true;
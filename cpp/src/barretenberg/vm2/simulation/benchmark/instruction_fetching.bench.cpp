@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/vm2/common/instruction_spec.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+using namespace bb::avm2::simulation;
+
+namespace {
+
+// A loop body as emitted for a simple counter loop: some arithmetic, a comparison and a conditional jump back.
+std::vector<uint8_t> get_loop_bytecode()
+{
+    const std::vector<Instruction> body = {
+        { .opcode = WireOpCode::ADD_8,
+          .operands = { Operand::from<uint8_t>(1), Operand::from<uint8_t>(2), Operand::from<uint8_t>(3) } },
+        { .opcode = WireOpCode::ADD_16,
+          .operands = { Operand::from<uint16_t>(3), Operand::from<uint16_t>(4), Operand::from<uint16_t>(5) } },
+        { .opcode = WireOpCode::LT_8,
+          .operands = { Operand::from<uint8_t>(5), Operand::from<uint8_t>(6), Operand::from<uint8_t>(7) } },
+        { .opcode = WireOpCode::JUMPI_32, .operands = { Operand::from<uint16_t>(7), Operand::from<uint32_t>(0) } },
+    };
+    std::vector<uint8_t> bytecode;
+    for (size_t i = 0; i < 4; i++) {
+        for (const auto& instruction : body) {
+            const auto serialized = instruction.serialize();
+            bytecode.insert(bytecode.end(), serialized.begin(), serialized.end());
+        }
+    }
+    return bytecode;
+}
+
+// The pcs visited by one iteration of the loop.
+std::vector<uint32_t> get_loop_pcs(const std::vector<uint8_t>& bytecode)
+{
+    std::vector<uint32_t> pcs;
+    for (size_t pc = 0; pc < bytecode.size();) {
+        pcs.push_back(static_cast<uint32_t>(pc));
+        pc += WIRE_INSTRUCTION_SPEC.at(static_cast<WireOpCode>(bytecode[pc])).size_in_bytes;
+    }
+    return pcs;
+}
+
+const size_t NUM_ITERATIONS = 1000;
+
+void fetch_by_deserializing(State& state) noexcept
+{
+    const auto bytecode = get_loop_bytecode();
+    const auto pcs = get_loop_pcs(bytecode);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_ITERATIONS; i++) {
+            for (uint32_t pc : pcs) {
+                DoNotOptimize(decode_instruction(bytecode, pc));
+            }
+        }
+    }
+}
+BENCHMARK(fetch_by_deserializing)->Unit(kMicrosecond);
+
+void fetch_from_decoded_bytecode(State& state) noexcept
+{
+    const auto bytecode = get_loop_bytecode();
+    const auto pcs = get_loop_pcs(bytecode);
+    for (auto _ : state) {
+        // Decoding is part of the measured cost, as it would be for the first call to a contract.
+        DecodedBytecode decoded(bytecode);
+        for (size_t i = 0; i < NUM_ITERATIONS; i++) {
+            for (uint32_t pc : pcs) {
+                // Fetching copies the instruction into the fetching event.
+                Instruction instruction = decoded.find(pc)->instruction;
+                DoNotOptimize(instruction);
+            }
+        }
+    }
+}
+BENCHMARK(fetch_from_decoded_bytecode)->Unit(kMicrosecond);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/memory_event.hpp"
+#include "barretenberg/vm2/simulation/events/range_check_event.hpp"
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
+#include "barretenberg/vm2/simulation/memory.hpp"
+#include "barretenberg/vm2/simulation/range_check.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+using namespace bb::avm2::simulation;
+
+namespace {
+
+// Each simulated instruction reads two operands and writes a result, as a binary ALU opcode would.
+const size_t NUM_INSTRUCTIONS = 1 << 16;
+// Working set of a typical contract: a few thousand slots near the bottom of memory plus a few far away.
+const MemoryAddress NUM_SLOTS = 4096;
+const MemoryAddress FAR_OFFSET = 1U << 30;
+
+MemoryAddress address_for(size_t i)
+{
+    const auto slot = static_cast<MemoryAddress>((i * 7919) % NUM_SLOTS);
+    return (i % 16 == 0) ? FAR_OFFSET + slot : slot;
+}
+
+// The previous hash map based storage, kept as a baseline.
+struct HashMapMemory {
+    const MemoryValue& get(MemoryAddress index) const
+    {
+        static const auto default_value = MemoryValue::from<FF>(0);
+        auto it = memory.find(index);
+        return it != memory.end() ? it->second : default_value;
+    }
+    void set(MemoryAddress index, const MemoryValue& value) { memory[index] = value; }
+
+    unordered_flat_map<size_t, MemoryValue> memory;
+};
+
+template <typename M> void run_instructions(M& memory)
+{
+    for (size_t i = 0; i < NUM_INSTRUCTIONS; i++) {
+        const auto& a = memory.get(address_for(i));
+        const auto& b = memory.get(address_for(i + 1));
+        DoNotOptimize(a);
+        DoNotOptimize(b);
+        memory.set(address_for(i + 2), MemoryValue::from<uint32_t>(static_cast<uint32_t>(i)));
+    }
+}
+
+template <typename M> void memory_storage(State& state) noexcept
+{
+    for (auto _ : state) {
+        M memory;
+        run_instructions(memory);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INSTRUCTIONS));
+}
+BENCHMARK(memory_storage<HashMapMemory>)->Unit(kMillisecond);
+BENCHMARK(memory_storage<PagedMemory>)->Unit(kMillisecond);
+
+// Full simulation memory, including tag validation, without event collection.
+void simulation_memory(State& state) noexcept
+{
+    NoopEventEmitter<RangeCheckEvent> range_check_emitter;
+    NoopEventEmitter<MemoryEvent> memory_emitter;
+    RangeCheck range_check(range_check_emitter);
+    for (auto _ : state) {
+        Memory memory(/*space_id=*/0, range_check, memory_emitter);
+        run_instructions(memory);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INSTRUCTIONS));
+}
+BENCHMARK(simulation_memory)->Unit(kMillisecond);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -39,15 +39,16 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
     info("Bytecode for ", address, " successfully retrieved!");
 
     FF bytecode_commitment = bytecode_hasher.compute_public_bytecode_commitment(bytecode_id, klass.packed_bytecode);
-    (void)bytecode_commitment; // Avoid GCC unused parameter warning when asserts are disabled.
     assert(bytecode_commitment == klass.public_bytecode_commitment);
     // We convert the bytecode to a shared_ptr because it will be shared by some events.
     auto shared_bytecode = std::make_shared<std::vector<uint8_t>>(std::move(klass.packed_bytecode));
     decomposition_events.emit({ .bytecode_id = bytecode_id, .bytecode = shared_bytecode });
+    auto decoded = decoded_bytecode_cache.get_or_decode(bytecode_commitment, *shared_bytecode);
 
     // We now save the bytecode so that we don't repeat this process.
     resolved_addresses[address] = bytecode_id;
-    bytecodes.emplace(bytecode_id, std::move(shared_bytecode));
+    bytecodes.emplace(bytecode_id,
+                      StoredBytecode{ .bytecode = std::move(shared_bytecode), .decoded = std::move(decoded) });
 
     auto tree_snapshots = merkle_db.get_tree_roots();
 
@@ -78,22 +79,20 @@ Instruction TxBytecodeManager::read_instruction(BytecodeId bytecode_id, uint32_t
     instr_fetching_event.bytecode_id = bytecode_id;
     instr_fetching_event.pc = pc;
 
-    auto bytecode_ptr = it->second;
+    const auto& bytecode_ptr = it->second.bytecode;
     instr_fetching_event.bytecode = bytecode_ptr;
 
-    const auto& bytecode = *bytecode_ptr;
-
+    // Instruction boundaries are served from the decoded table. Anything else (e.g., a jump into the
+    // middle of an instruction or past the end) is decoded here, which is rare.
     // TODO: Propagate instruction fetching error to the upper layer (execution loop)
-    try {
-        instr_fetching_event.instruction = deserialize_instruction(bytecode, pc);
-
-        // If the following code is executed, no error was thrown in deserialize_instruction().
-        if (!check_tag(instr_fetching_event.instruction)) {
-            instr_fetching_event.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
-        };
-    } catch (const InstrDeserializationError& error) {
-        assert(error != InstrDeserializationError::TAG_OUT_OF_RANGE);
-        instr_fetching_event.error = error;
+    const DecodedInstruction* decoded = it->second.decoded->find(pc);
+    if (decoded != nullptr) {
+        instr_fetching_event.instruction = decoded->instruction;
+        instr_fetching_event.error = decoded->error;
+    } else {
+        auto decoded_at_pc = decode_instruction(*bytecode_ptr, pc);
+        instr_fetching_event.instruction = std::move(decoded_at_pc.instruction);
+        instr_fetching_event.error = decoded_at_pc.error;
     }
 
     // We are showing whether bytecode_size > pc or not. If there is no fetching error,
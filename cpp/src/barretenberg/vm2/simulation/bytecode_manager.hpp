@@ -16,6 +16,7 @@
 #include "barretenberg/vm2/simulation/events/bytecode_events.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/lib/db_interfaces.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 #include "barretenberg/vm2/simulation/lib/serialization.hpp"
 #include "barretenberg/vm2/simulation/range_check.hpp"
 #include "barretenberg/vm2/simulation/siloing.hpp"
@@ -33,7 +34,7 @@ class TxBytecodeManagerInterface {
     // (1) sets up the address-class id connection,
     // (2) hashes it if needed.
     virtual BytecodeId get_bytecode(const AztecAddress& address) = 0;
-    // Retrieves an instruction and decomposes it if needed.
+    // Retrieves an instruction. Instructions are decoded once per bytecode, not on every fetch.
     virtual Instruction read_instruction(BytecodeId bytecode_id, uint32_t pc) = 0;
 };
 
@@ -48,7 +49,8 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
                       uint32_t current_block_number,
                       EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events,
                       EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events,
-                      EventEmitterInterface<InstructionFetchingEvent>& fetching_events)
+                      EventEmitterInterface<InstructionFetchingEvent>& fetching_events,
+                      DecodedBytecodeCache& decoded_bytecode_cache)
         : contract_db(contract_db)
         , merkle_db(merkle_db)
         , poseidon2(poseidon2)
@@ -59,12 +61,18 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
         , retrieval_events(retrieval_events)
         , decomposition_events(decomposition_events)
         , fetching_events(fetching_events)
+        , decoded_bytecode_cache(decoded_bytecode_cache)
     {}
 
     BytecodeId get_bytecode(const AztecAddress& address) override;
     Instruction read_instruction(BytecodeId bytecode_id, uint32_t pc) override;
 
   private:
+    struct StoredBytecode {
+        std::shared_ptr<std::vector<uint8_t>> bytecode;
+        std::shared_ptr<const DecodedBytecode> decoded;
+    };
+
     ContractDBInterface& contract_db;
     HighLevelMerkleDBInterface& merkle_db;
     Poseidon2Interface& poseidon2;
@@ -76,7 +84,8 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
     EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events;
     EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events;
     EventEmitterInterface<InstructionFetchingEvent>& fetching_events;
-    unordered_flat_map<BytecodeId, std::shared_ptr<std::vector<uint8_t>>> bytecodes;
+    DecodedBytecodeCache& decoded_bytecode_cache;
+    unordered_flat_map<BytecodeId, StoredBytecode> bytecodes;
     unordered_flat_map<AztecAddress, BytecodeId> resolved_addresses;
     BytecodeId next_bytecode_id = 0;
 };
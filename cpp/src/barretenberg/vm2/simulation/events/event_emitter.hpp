@@ -1,15 +1,15 @@
 #pragma once
 
 #include <cassert>
-#include <vector>
 
 #include "barretenberg/vm2/common/set.hpp"
+#include "barretenberg/vm2/simulation/events/event_log.hpp"
 
 namespace bb::avm2::simulation {
 
 template <typename Event> class EventEmitterInterface {
   public:
-    using Container = std::vector<Event>;
+    using Container = EventLog<Event>;
 
     virtual ~EventEmitterInterface() = default;
     // Pushes the event to the event container.
@@ -18,7 +18,7 @@ template <typename Event> class EventEmitterInterface {
 
 template <typename Event> class EventEmitter : public EventEmitterInterface<Event> {
   public:
-    using Container = std::vector<Event>;
+    using Container = EventLog<Event>;
 
     virtual ~EventEmitter() = default;
     void emit(Event&& event) override { events.push_back(std::move(event)); };
@@ -57,7 +57,7 @@ template <typename Event> class DeduplicatingEventEmitter : public EventEmitter<
 
 template <typename Event> class NoopEventEmitter : public EventEmitterInterface<Event> {
   public:
-    using Container = std::vector<Event>;
+    using Container = EventLog<Event>;
 
     virtual ~NoopEventEmitter() = default;
 
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace bb::avm2::simulation {
+
+// An append-only log of events, stored in fixed-capacity chunks.
+//
+// Appending never moves events that are already in the log: a full chunk is left as is and a new one is started.
+// This avoids the reallocation copies of a growing std::vector (events are emitted millions of times per tx), keeps
+// references to events stable, and lets consumers process the log chunk by chunk (e.g., in parallel).
+// All the memory is released at once on clear() or destruction.
+template <typename Event> class EventLog {
+  public:
+    using value_type = Event;
+    using size_type = size_t;
+    using reference = const Event&;
+    using const_reference = const Event&;
+
+    // Chunks hold roughly 64KiB worth of events, and at least one event.
+    static constexpr size_t CHUNK_SIZE = std::bit_floor(std::max<size_t>(1, (1 << 16) / sizeof(Event)));
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Event;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Event*;
+        using reference = const Event&;
+
+        const_iterator() = default;
+        const_iterator(const EventLog* log, size_t index)
+            : log(log)
+            , index(index)
+        {}
+
+        reference operator*() const { return (*log)[index]; }
+        pointer operator->() const { return &(*log)[index]; }
+        const_iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+            ++index;
+            return tmp;
+        }
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+
+      private:
+        const EventLog* log = nullptr;
+        size_t index = 0;
+    };
+    using iterator = const_iterator;
+
+    EventLog() = default;
+    EventLog(std::initializer_list<Event> events) { append(events.begin(), events.end()); }
+    // Mostly for tests, which build their events as vectors.
+    EventLog(const std::vector<Event>& events) { append(events.begin(), events.end()); }
+
+    // Copies are re-chunked so that their chunks also have full capacity.
+    EventLog(const EventLog& other) { append(other.begin(), other.end()); }
+    EventLog& operator=(const EventLog& other)
+    {
+        if (this != &other) {
+            *this = EventLog(other);
+        }
+        return *this;
+    }
+    // A moved-from log is left empty.
+    EventLog(EventLog&& other) noexcept
+        : chunks(std::move(other.chunks))
+        , num_events(std::exchange(other.num_events, 0))
+    {
+        other.chunks.clear();
+    }
+    EventLog& operator=(EventLog&& other) noexcept
+    {
+        chunks = std::move(other.chunks);
+        num_events = std::exchange(other.num_events, 0);
+        other.chunks.clear();
+        return *this;
+    }
+    ~EventLog() = default;
+
+    void push_back(Event&& event)
+    {
+        if (chunks.empty() || chunks.back().size() == CHUNK_SIZE) {
+            chunks.emplace_back().reserve(CHUNK_SIZE);
+        }
+        chunks.back().push_back(std::move(event));
+        num_events++;
+    }
+    void push_back(const Event& event) { push_back(Event(event)); }
+
+    const Event& operator[](size_t index) const
+    {
+        assert(index < num_events);
+        return chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+    }
+    size_t size() const { return num_events; }
+    bool empty() const { return num_events == 0; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, num_events); }
+
+    size_t num_chunks() const { return chunks.size(); }
+    std::span<const Event> get_chunk(size_t chunk_index) const { return chunks[chunk_index]; }
+
+    // Bytes reserved for the events themselves (not including memory owned by the events).
+    size_t memory_usage() const { return chunks.size() * CHUNK_SIZE * sizeof(Event); }
+
+    void clear()
+    {
+        chunks.clear();
+        num_events = 0;
+    }
+    void shrink_to_fit() { chunks.shrink_to_fit(); }
+
+    std::vector<Event> to_vector() const { return std::vector<Event>(begin(), end()); }
+
+  private:
+    template <typename It> void append(It first, It last)
+    {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    // Each chunk is reserved to CHUNK_SIZE upfront and never grows past it, so its events never move.
+    std::vector<std::vector<Event>> chunks;
+    size_t num_events = 0;
+};
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,64 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/vm2/simulation/events/event_log.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using testing::ElementsAre;
+
+using Log = EventLog<uint64_t>;
+
+TEST(EventLogTest, AppendAcrossChunksKeepsAddresses)
+{
+    Log log;
+    log.push_back(0);
+    const uint64_t* first = &log[0];
+
+    const size_t num_events = 2 * Log::CHUNK_SIZE + 1;
+    for (size_t i = 1; i < num_events; i++) {
+        log.push_back(i);
+    }
+
+    EXPECT_EQ(log.size(), num_events);
+    EXPECT_EQ(log.num_chunks(), 3U);
+    EXPECT_EQ(&log[0], first);
+    EXPECT_EQ(log.get_chunk(1).size(), Log::CHUNK_SIZE);
+    EXPECT_EQ(log.get_chunk(2).size(), 1U);
+    EXPECT_EQ(log.memory_usage(), 3 * Log::CHUNK_SIZE * sizeof(uint64_t));
+
+    uint64_t expected = 0;
+    for (uint64_t value : log) {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, num_events);
+}
+
+TEST(EventLogTest, MoveLeavesSourceEmpty)
+{
+    Log log = { 1, 2, 3 };
+    Log moved = std::move(log);
+
+    EXPECT_THAT(moved, ElementsAre(1U, 2U, 3U));
+    EXPECT_TRUE(log.empty()); // NOLINT(bugprone-use-after-move)
+
+    moved.clear();
+    EXPECT_EQ(moved.size(), 0U);
+    EXPECT_EQ(moved.num_chunks(), 0U);
+}
+
+TEST(EventLogTest, ConstructFromVector)
+{
+    const std::vector<uint64_t> events = { 4, 5 };
+    const Log log(events);
+    EXPECT_THAT(log, ElementsAre(4U, 5U));
+    EXPECT_EQ(log.to_vector(), events);
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
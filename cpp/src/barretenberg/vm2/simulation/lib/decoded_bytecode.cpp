@@ -0,0 +1,81 @@
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+
+#include <cassert>
+
+#include "barretenberg/vm2/common/instruction_spec.hpp"
+
+namespace bb::avm2::simulation {
+
+DecodedInstruction decode_instruction(std::span<const uint8_t> bytecode, uint32_t pc)
+{
+    DecodedInstruction decoded;
+    try {
+        decoded.instruction = deserialize_instruction(bytecode, pc);
+
+        // If the following code is executed, no error was thrown in deserialize_instruction().
+        if (!check_tag(decoded.instruction)) {
+            decoded.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
+        }
+    } catch (const InstrDeserializationError& error) {
+        assert(error != InstrDeserializationError::TAG_OUT_OF_RANGE);
+        decoded.error = error;
+    }
+    return decoded;
+}
+
+DecodedBytecode::DecodedBytecode(std::span<const uint8_t> bytecode)
+    : pc_to_instruction(bytecode.size(), NOT_DECODED)
+{
+    size_t pc = 0;
+    while (pc < bytecode.size()) {
+        pc_to_instruction[pc] = static_cast<uint32_t>(instructions.size());
+        instructions.push_back(decode_instruction(bytecode, static_cast<uint32_t>(pc)));
+
+        const auto& decoded = instructions.back();
+        // Past an undecodable instruction we no longer know where the next one starts.
+        if (decoded.error.has_value() && decoded.error != InstrDeserializationError::TAG_OUT_OF_RANGE) {
+            break;
+        }
+        pc += WIRE_INSTRUCTION_SPEC.at(decoded.instruction.opcode).size_in_bytes;
+    }
+    instructions.shrink_to_fit();
+}
+
+std::shared_ptr<const DecodedBytecode> DecodedBytecodeCache::get_or_decode(const FF& bytecode_commitment,
+                                                                           std::span<const uint8_t> bytecode)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(bytecode_commitment);
+        if (it != entries.end()) {
+            lru.splice(lru.begin(), lru, it->second);
+            return it->second->second;
+        }
+    }
+
+    // Decoding is done without holding the lock. If two callers race on the same bytecode, the first one to
+    // insert wins and both end up with the same table.
+    auto decoded = std::make_shared<const DecodedBytecode>(bytecode);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(bytecode_commitment);
+    if (it != entries.end()) {
+        lru.splice(lru.begin(), lru, it->second);
+        return it->second->second;
+    }
+    lru.emplace_front(bytecode_commitment, decoded);
+    entries.emplace(bytecode_commitment, lru.begin());
+    while (lru.size() > capacity) {
+        entries.erase(lru.back().first);
+        lru.pop_back();
+    }
+    return decoded;
+}
+
+size_t DecodedBytecodeCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return lru.size();
+}
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+namespace bb::avm2::simulation {
+
+struct DecodedInstruction {
+    Instruction instruction;
+    std::optional<InstrDeserializationError> error;
+};
+
+// Decodes the instruction at pc, turning deserialization errors (and invalid tags) into an error value.
+DecodedInstruction decode_instruction(std::span<const uint8_t> bytecode, uint32_t pc);
+
+// A pc-indexed table of the instructions of a bytecode, decoded once up front.
+//
+// The table is built by walking the instruction stream from pc 0. Execution can jump into the middle of
+// an instruction, so pcs that are not instruction boundaries are not in the table and have to be decoded
+// on demand by the caller. The table is immutable once built and can be shared across threads.
+class DecodedBytecode {
+  public:
+    explicit DecodedBytecode(std::span<const uint8_t> bytecode);
+
+    // Returns nullptr if pc is not the start of an instruction in the stream.
+    const DecodedInstruction* find(uint32_t pc) const
+    {
+        if (pc >= pc_to_instruction.size() || pc_to_instruction[pc] == NOT_DECODED) {
+            return nullptr;
+        }
+        return &instructions[pc_to_instruction[pc]];
+    }
+    size_t num_instructions() const { return instructions.size(); }
+
+  private:
+    static constexpr uint32_t NOT_DECODED = UINT32_MAX;
+
+    std::vector<uint32_t> pc_to_instruction;
+    std::vector<DecodedInstruction> instructions;
+};
+
+// Decoded bytecodes keyed by bytecode commitment, so that a bytecode is decoded once and shared by
+// all the calls and transactions that use it. The least recently used entries are evicted.
+class DecodedBytecodeCache {
+  public:
+    explicit DecodedBytecodeCache(size_t capacity)
+        : capacity(capacity)
+    {}
+
+    std::shared_ptr<const DecodedBytecode> get_or_decode(const FF& bytecode_commitment,
+                                                         std::span<const uint8_t> bytecode);
+    size_t size() const;
+
+  private:
+    using Entry = std::pair<FF, std::shared_ptr<const DecodedBytecode>>;
+
+    const size_t capacity;
+    mutable std::mutex mutex;
+    // Most recently used first.
+    std::list<Entry> lru;
+    unordered_flat_map<FF, std::list<Entry>::iterator> entries;
+};
+
+} // namespace bb::avm2::simulation
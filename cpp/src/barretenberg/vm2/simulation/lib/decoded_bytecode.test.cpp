@@ -0,0 +1,79 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+const Instruction add_8 = { .opcode = WireOpCode::ADD_8,
+                            .indirect = 0,
+                            .operands = { Operand::from<uint8_t>(1),
+                                          Operand::from<uint8_t>(2),
+                                          Operand::from<uint8_t>(3) } };
+const Instruction jump_32 = { .opcode = WireOpCode::JUMP_32, .operands = { Operand::from<uint32_t>(0) } };
+
+std::vector<uint8_t> concat(const std::vector<Instruction>& instructions)
+{
+    std::vector<uint8_t> bytecode;
+    for (const auto& instruction : instructions) {
+        const auto serialized = instruction.serialize();
+        bytecode.insert(bytecode.end(), serialized.begin(), serialized.end());
+    }
+    return bytecode;
+}
+
+TEST(DecodedBytecodeTest, DecodesInstructionBoundaries)
+{
+    const auto bytecode = concat({ add_8, jump_32 });
+    const uint32_t jump_pc = static_cast<uint32_t>(add_8.serialize().size());
+    DecodedBytecode decoded(bytecode);
+
+    EXPECT_EQ(decoded.num_instructions(), 2U);
+    ASSERT_NE(decoded.find(0), nullptr);
+    EXPECT_EQ(decoded.find(0)->instruction, add_8);
+    EXPECT_FALSE(decoded.find(0)->error.has_value());
+    ASSERT_NE(decoded.find(jump_pc), nullptr);
+    EXPECT_EQ(decoded.find(jump_pc)->instruction, jump_32);
+
+    // Not instruction boundaries.
+    EXPECT_EQ(decoded.find(1), nullptr);
+    EXPECT_EQ(decoded.find(static_cast<uint32_t>(bytecode.size())), nullptr);
+}
+
+TEST(DecodedBytecodeTest, StopsAtTruncatedInstruction)
+{
+    auto bytecode = concat({ add_8, jump_32 });
+    bytecode.pop_back();
+    const uint32_t jump_pc = static_cast<uint32_t>(add_8.serialize().size());
+    DecodedBytecode decoded(bytecode);
+
+    ASSERT_NE(decoded.find(jump_pc), nullptr);
+    EXPECT_EQ(decoded.find(jump_pc)->error, InstrDeserializationError::INSTRUCTION_OUT_OF_RANGE);
+    EXPECT_EQ(decoded.find(jump_pc)->error, decode_instruction(bytecode, jump_pc).error);
+}
+
+TEST(DecodedBytecodeTest, CacheSharesAndEvicts)
+{
+    const auto bytecode = concat({ add_8 });
+    DecodedBytecodeCache cache(2);
+
+    auto first = cache.get_or_decode(FF(1), bytecode);
+    EXPECT_EQ(cache.get_or_decode(FF(1), bytecode), first);
+
+    cache.get_or_decode(FF(2), bytecode);
+    // Touch 1 so that 2 is the least recently used.
+    cache.get_or_decode(FF(1), bytecode);
+    auto third = cache.get_or_decode(FF(3), bytecode);
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(cache.get_or_decode(FF(1), bytecode), first);
+    EXPECT_EQ(cache.get_or_decode(FF(3), bytecode), third);
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -0,0 +1,46 @@
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
+
+namespace bb::avm2::simulation {
+
+PagedMemory::Page& PagedMemory::get_or_create_page(MemoryAddress address)
+{
+    if (directory.empty()) {
+        directory.resize(DIRECTORY_SIZE);
+    }
+    auto& table = directory[directory_index(address)];
+    if (table == nullptr) {
+        table = std::make_unique<PageTable>();
+    }
+    auto& page = (*table)[table_index(address)];
+    if (page == nullptr) {
+        page = std::make_unique<Page>();
+        page->fill(default_value());
+        num_pages++;
+    }
+    return *page;
+}
+
+void PagedMemory::visit(const std::function<void(MemoryAddress, const MemoryValue&)>& visitor) const
+{
+    for (size_t dir_idx = 0; dir_idx < directory.size(); dir_idx++) {
+        const auto& table = directory[dir_idx];
+        if (table == nullptr) {
+            continue;
+        }
+        for (size_t table_idx = 0; table_idx < TABLE_SIZE; table_idx++) {
+            const auto& page = (*table)[table_idx];
+            if (page == nullptr) {
+                continue;
+            }
+            const size_t first_address = ((dir_idx << TABLE_SIZE_LOG2) | table_idx) << PAGE_SIZE_LOG2;
+            for (size_t offset = 0; offset < PAGE_SIZE; offset++) {
+                const MemoryValue& value = (*page)[offset];
+                if (value != default_value()) {
+                    visitor(static_cast<MemoryAddress>(first_address + offset), value);
+                }
+            }
+        }
+    }
+}
+
+} // namespace bb::avm2::simulation
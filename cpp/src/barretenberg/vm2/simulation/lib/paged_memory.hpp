@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+
+namespace bb::avm2::simulation {
+
+// A flat view of a 32-bit address space, stored as lazily allocated fixed-size pages.
+//
+// Addresses are split into a directory index, a page table index and an offset within the page, so that
+// lookups are a couple of array accesses instead of hashing the address. Pages are only allocated when
+// written to, and unwritten addresses read as FF(0). Values are never moved once their page is allocated,
+// so references returned by get() stay valid for the lifetime of the memory.
+class PagedMemory {
+  public:
+    static constexpr size_t PAGE_SIZE_LOG2 = 10;
+    static constexpr size_t PAGE_SIZE = 1 << PAGE_SIZE_LOG2;
+    static constexpr size_t TABLE_SIZE_LOG2 = 12;
+    static constexpr size_t TABLE_SIZE = 1 << TABLE_SIZE_LOG2;
+    static constexpr size_t DIRECTORY_SIZE = 1 << (32 - TABLE_SIZE_LOG2 - PAGE_SIZE_LOG2);
+
+    const MemoryValue& get(MemoryAddress address) const
+    {
+        const Page* page = find_page(address);
+        return page == nullptr ? default_value() : (*page)[address & (PAGE_SIZE - 1)];
+    }
+    void set(MemoryAddress address, const MemoryValue& value)
+    {
+        get_or_create_page(address)[address & (PAGE_SIZE - 1)] = value;
+    }
+
+    // Visits the values other than the default FF(0), in ascending address order.
+    void visit(const std::function<void(MemoryAddress, const MemoryValue&)>& visitor) const;
+    size_t num_allocated_pages() const { return num_pages; }
+
+  private:
+    using Page = std::array<MemoryValue, PAGE_SIZE>;
+    using PageTable = std::array<std::unique_ptr<Page>, TABLE_SIZE>;
+
+    static const MemoryValue& default_value()
+    {
+        static const auto value = MemoryValue::from<FF>(0);
+        return value;
+    }
+    static size_t directory_index(MemoryAddress address) { return address >> (PAGE_SIZE_LOG2 + TABLE_SIZE_LOG2); }
+    static size_t table_index(MemoryAddress address) { return (address >> PAGE_SIZE_LOG2) & (TABLE_SIZE - 1); }
+
+    const Page* find_page(MemoryAddress address) const
+    {
+        if (directory.empty()) {
+            return nullptr;
+        }
+        const auto& table = directory[directory_index(address)];
+        return table == nullptr ? nullptr : (*table)[table_index(address)].get();
+    }
+    Page& get_or_create_page(MemoryAddress address);
+
+    // Empty until the first write.
+    std::vector<std::unique_ptr<PageTable>> directory;
+    size_t num_pages = 0;
+};
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,60 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using testing::ElementsAre;
+using testing::Pair;
+
+TEST(PagedMemoryTest, UnsetAddressesReadAsZeroField)
+{
+    PagedMemory memory;
+    EXPECT_EQ(memory.get(0), MemoryValue::from<FF>(0));
+    EXPECT_EQ(memory.get(UINT32_MAX), MemoryValue::from<FF>(0));
+    EXPECT_EQ(memory.num_allocated_pages(), 0U);
+}
+
+TEST(PagedMemoryTest, SetAndGetAcrossPages)
+{
+    PagedMemory memory;
+    memory.set(1, MemoryValue::from<uint8_t>(7));
+    memory.set(PagedMemory::PAGE_SIZE + 1, MemoryValue::from<uint32_t>(8));
+    memory.set(UINT32_MAX, MemoryValue::from<FF>(9));
+
+    EXPECT_EQ(memory.get(1), MemoryValue::from<uint8_t>(7));
+    EXPECT_EQ(memory.get(2), MemoryValue::from<FF>(0));
+    EXPECT_EQ(memory.get(PagedMemory::PAGE_SIZE + 1), MemoryValue::from<uint32_t>(8));
+    EXPECT_EQ(memory.get(UINT32_MAX), MemoryValue::from<FF>(9));
+    EXPECT_EQ(memory.num_allocated_pages(), 3U);
+
+    // References stay valid across writes to other addresses.
+    const auto& value = memory.get(1);
+    memory.set(5 * PagedMemory::PAGE_SIZE, MemoryValue::from<uint8_t>(1));
+    EXPECT_EQ(value, MemoryValue::from<uint8_t>(7));
+}
+
+TEST(PagedMemoryTest, VisitsInAddressOrder)
+{
+    PagedMemory memory;
+    memory.set(UINT32_MAX, MemoryValue::from<uint8_t>(3));
+    memory.set(PagedMemory::PAGE_SIZE, MemoryValue::from<uint8_t>(2));
+    memory.set(0, MemoryValue::from<uint8_t>(1));
+
+    std::vector<std::pair<MemoryAddress, MemoryValue>> visited;
+    memory.visit([&](MemoryAddress address, const MemoryValue& value) { visited.emplace_back(address, value); });
+    EXPECT_THAT(visited,
+                ElementsAre(Pair(0U, MemoryValue::from<uint8_t>(1)),
+                            Pair(static_cast<MemoryAddress>(PagedMemory::PAGE_SIZE), MemoryValue::from<uint8_t>(2)),
+                            Pair(UINT32_MAX, MemoryValue::from<uint8_t>(3))));
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -25,7 +25,7 @@ void Memory::set(MemoryAddress index, MemoryValue value)
     // TODO: validate address?
     // TODO: reconsider tag validation.
     validate_tag(value);
-    memory[index] = value;
+    memory.set(index, value);
     debug("Memory write: ", index, " <- ", value.to_string());
     events.emit({ .mode = MemoryMode::WRITE, .addr = index, .value = value, .space_id = space_id });
 }
@@ -33,10 +33,7 @@ void Memory::set(MemoryAddress index, MemoryValue value)
 const MemoryValue& Memory::get(MemoryAddress index) const
 {
     // TODO: validate address?
-    static const auto default_value = MemoryValue::from<FF>(0);
-
-    auto it = memory.find(index);
-    const auto& vt = it != memory.end() ? it->second : default_value;
+    const auto& vt = memory.get(index);
     events.emit({ .mode = MemoryMode::READ, .addr = index, .value = vt, .space_id = space_id });
 
     debug("Memory read: ", index, " -> ", vt.to_string());
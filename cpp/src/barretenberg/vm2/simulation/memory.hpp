@@ -2,10 +2,10 @@
 
 #include <memory>
 
-#include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/common/memory_types.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/memory_event.hpp"
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
 #include "barretenberg/vm2/simulation/range_check.hpp"
 
 namespace bb::avm2::simulation {
@@ -40,7 +40,7 @@ class Memory : public MemoryInterface {
 
   private:
     uint32_t space_id;
-    unordered_flat_map<size_t, MemoryValue> memory;
+    PagedMemory memory;
 
     RangeCheckInterface& range_check;
     // TODO: consider a deduplicating event emitter (within the same clk).
@@ -56,18 +56,13 @@ class MemoryStore : public MemoryInterface {
         : space_id(space_id)
     {}
 
-    const MemoryValue& get(MemoryAddress index) const override
-    {
-        static const auto default_value = MemoryValue::from<FF>(0);
-        auto it = memory.find(index);
-        return it != memory.end() ? it->second : default_value;
-    }
-    void set(MemoryAddress index, MemoryValue value) override { memory[index] = value; }
+    const MemoryValue& get(MemoryAddress index) const override { return memory.get(index); }
+    void set(MemoryAddress index, MemoryValue value) override { memory.set(index, value); }
     uint32_t get_space_id() const override { return space_id; }
 
   private:
     uint32_t space_id;
-    unordered_flat_map<size_t, MemoryValue> memory;
+    PagedMemory memory;
 };
 
 } // namespace bb::avm2::simulation
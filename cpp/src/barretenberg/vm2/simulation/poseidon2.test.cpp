@@ -32,7 +32,7 @@ TEST(Poseidon2SimulationTest, Hash)
     FF expected("0x2f43a0f83b51a6f5fc839dea0ecec74947637802a579fa9841930a25a0bcec11");
     EXPECT_EQ(result, expected);
 
-    std::vector<Poseidon2HashEvent> event_result = hash_event_emitter.dump_events();
+    auto event_result = hash_event_emitter.dump_events();
 
     EXPECT_THAT(event_result,
                 ElementsAre(testing::AllOf(Field(&Poseidon2HashEvent::inputs, ElementsAreArray(input)),
@@ -63,7 +63,7 @@ TEST(Poseidon2SimulationTest, Permutation)
     };
     EXPECT_THAT(result, ElementsAreArray(expected));
 
-    std::vector<Poseidon2PermutationEvent> event_results = perm_event_emitter.dump_events();
+    auto event_results = perm_event_emitter.dump_events();
 
     EXPECT_THAT(event_results,
                 ElementsAre(AllOf(Field(&Poseidon2PermutationEvent::input, ElementsAreArray(input)),
@@ -1,6 +1,8 @@
 #include "barretenberg/vm2/simulation_helper.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <string>
 
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/vm2/common/avm_inputs.hpp"
@@ -34,6 +36,7 @@
 #include "barretenberg/vm2/simulation/execution.hpp"
 #include "barretenberg/vm2/simulation/execution_components.hpp"
 #include "barretenberg/vm2/simulation/field_gt.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 #include "barretenberg/vm2/simulation/lib/instruction_info.hpp"
 #include "barretenberg/vm2/simulation/lib/raw_data_dbs.hpp"
 #include "barretenberg/vm2/simulation/merkle_check.hpp"
@@ -44,6 +47,7 @@
 #include "barretenberg/vm2/simulation/to_radix.hpp"
 #include "barretenberg/vm2/simulation/tx_execution.hpp"
 #include "barretenberg/vm2/simulation/update_check.hpp"
+#include "barretenberg/vm2/tooling/stats.hpp"
 
 namespace bb::avm2 {
 
@@ -63,6 +67,51 @@ struct FastSettings {
     template <typename E> using DefaultDeduplicatingEventEmitter = NoopEventEmitter<E>;
 };
 
+// Maximum number of decoded bytecodes kept around between simulations.
+constexpr size_t DECODED_BYTECODE_CACHE_SIZE = 256;
+
+// Decoded bytecodes are shared by all the simulations in the process, e.g., by all the txs of a block.
+DecodedBytecodeCache& get_decoded_bytecode_cache()
+{
+    static DecodedBytecodeCache cache(DECODED_BYTECODE_CACHE_SIZE);
+    return cache;
+}
+
+// Reports the number of events and the bytes used to store them, per event type.
+void report_event_stats([[maybe_unused]] const EventsContainer& events)
+{
+#ifdef AVM_TRACK_STATS
+    auto report = [](const std::string& name, const auto& container) {
+        Stats::get().increment("simulation/events/" + name + "_count", container.size());
+        Stats::get().increment("simulation/events/" + name + "_bytes", container.memory_usage());
+    };
+    report("execution", events.execution);
+    report("alu", events.alu);
+    report("bitwise", events.bitwise);
+    report("memory", events.memory);
+    report("bytecode_retrieval", events.bytecode_retrieval);
+    report("bytecode_hashing", events.bytecode_hashing);
+    report("bytecode_decomposition", events.bytecode_decomposition);
+    report("instruction_fetching", events.instruction_fetching);
+    report("address_derivation", events.address_derivation);
+    report("class_id_derivation", events.class_id_derivation);
+    report("siloing", events.siloing);
+    report("sha256_compression", events.sha256_compression);
+    report("ecc_add", events.ecc_add);
+    report("scalar_mul", events.scalar_mul);
+    report("poseidon2_hash", events.poseidon2_hash);
+    report("poseidon2_permutation", events.poseidon2_permutation);
+    report("to_radix", events.to_radix);
+    report("field_gt", events.field_gt);
+    report("merkle_check", events.merkle_check);
+    report("range_check", events.range_check);
+    report("context_stack", events.context_stack);
+    report("public_data_tree_check", events.public_data_tree_check_events);
+    report("update_check", events.update_check_events);
+    report("nullifier_tree_check", events.nullifier_tree_check_events);
+#endif
+}
+
 } // namespace
 
 template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings()
@@ -123,7 +172,8 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
                                        current_block_number,
                                        bytecode_retrieval_emitter,
                                        bytecode_decomposition_emitter,
-                                       instruction_fetching_emitter);
+                                       instruction_fetching_emitter,
+                                       get_decoded_bytecode_cache());
     ExecutionComponentsProvider execution_components(
         bytecode_manager, range_check, memory_emitter, instruction_info_db);
 
@@ -134,30 +184,32 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
 
     tx_execution.simulate(hints.tx);
 
-    return { execution_emitter.dump_events(),
-             alu_emitter.dump_events(),
-             bitwise_emitter.dump_events(),
-             memory_emitter.dump_events(),
-             bytecode_retrieval_emitter.dump_events(),
-             bytecode_hashing_emitter.dump_events(),
-             bytecode_decomposition_emitter.dump_events(),
-             instruction_fetching_emitter.dump_events(),
-             address_derivation_emitter.dump_events(),
-             class_id_derivation_emitter.dump_events(),
-             siloing_emitter.dump_events(),
-             sha256_compression_emitter.dump_events(),
-             ecc_add_emitter.dump_events(),
-             scalar_mul_emitter.dump_events(),
-             poseidon2_hash_emitter.dump_events(),
-             poseidon2_perm_emitter.dump_events(),
-             to_radix_emitter.dump_events(),
-             field_gt_emitter.dump_events(),
-             merkle_check_emitter.dump_events(),
-             range_check_emitter.dump_events(),
-             context_stack_emitter.dump_events(),
-             public_data_tree_check_emitter.dump_events(),
-             update_check_emitter.dump_events(),
-             nullifier_tree_check_emitter.dump_events() };
+    EventsContainer events = { execution_emitter.dump_events(),
+                               alu_emitter.dump_events(),
+                               bitwise_emitter.dump_events(),
+                               memory_emitter.dump_events(),
+                               bytecode_retrieval_emitter.dump_events(),
+                               bytecode_hashing_emitter.dump_events(),
+                               bytecode_decomposition_emitter.dump_events(),
+                               instruction_fetching_emitter.dump_events(),
+                               address_derivation_emitter.dump_events(),
+                               class_id_derivation_emitter.dump_events(),
+                               siloing_emitter.dump_events(),
+                               sha256_compression_emitter.dump_events(),
+                               ecc_add_emitter.dump_events(),
+                               scalar_mul_emitter.dump_events(),
+                               poseidon2_hash_emitter.dump_events(),
+                               poseidon2_perm_emitter.dump_events(),
+                               to_radix_emitter.dump_events(),
+                               field_gt_emitter.dump_events(),
+                               merkle_check_emitter.dump_events(),
+                               range_check_emitter.dump_events(),
+                               context_stack_emitter.dump_events(),
+                               public_data_tree_check_emitter.dump_events(),
+                               update_check_emitter.dump_events(),
+                               nullifier_tree_check_emitter.dump_events() };
+    report_event_stats(events);
+    return events;
 }
 
 EventsContainer AvmSimulationHelper::simulate()
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
 namespace bb::avm2::tracegen {
@@ -8,6 +13,12 @@ class InteractionBuilderInterface {
   public:
     virtual ~InteractionBuilderInterface() = default;
     virtual void process(TraceContainer& trace) = 0;
+    // Same as process, but the work is split across all threads.
+    // This uses parallel_for, so it must not be called from within a parallel_for.
+    virtual void process_parallel(TraceContainer& trace) { process(trace); }
+    // Rough measure of the work needed to process the interaction, used to schedule it.
+    virtual size_t get_work_size(const TraceContainer&) const { return 0; }
+    virtual std::string_view get_name() const = 0;
 };
 
 // We set a dummy value in the inverse column so that the size of the column is right.
@@ -20,4 +31,19 @@ template <typename LookupSettings> void SetDummyInverses(TraceContainer& trace)
                        [&](uint32_t row, const FF&) { trace.set(LookupSettings::INVERSES, row, 0xdeadbeef); });
 }
 
+// Splits [0, num_items) into num_threads contiguous ranges and calls func(start, end, thread_index) for each of them.
+// With a single thread the function is called inline, so this is also safe to use from within a parallel_for.
+inline void run_partitioned(size_t num_threads,
+                            size_t num_items,
+                            const std::function<void(size_t, size_t, size_t)>& func)
+{
+    if (num_threads <= 1) {
+        func(0, num_items, 0);
+        return;
+    }
+    bb::parallel_for(num_threads, [&](size_t thread_index) {
+        func(num_items * thread_index / num_threads, num_items * (thread_index + 1) / num_threads, thread_index);
+    });
+}
+
 } // namespace bb::avm2::tracegen
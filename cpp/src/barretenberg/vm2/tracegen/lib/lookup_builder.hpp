@@ -5,7 +5,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <string_view>
+#include <vector>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/utils.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
@@ -20,9 +23,24 @@ template <typename LookupSettings_> class BaseLookupTraceBuilder : public Intera
   public:
     ~BaseLookupTraceBuilder() override = default;
 
-    void process(TraceContainer& trace) override
+    void process(TraceContainer& trace) override { process_with_threads(trace, 1); }
+    void process_parallel(TraceContainer& trace) override { process_with_threads(trace, bb::get_num_cpus()); }
+    size_t get_work_size(const TraceContainer& trace) const override
+    {
+        return trace.get_column_rows(LookupSettings::SRC_SELECTOR);
+    }
+    std::string_view get_name() const override { return LookupSettings::NAME; }
+
+  protected:
+    using LookupSettings = LookupSettings_;
+    virtual uint32_t find_in_dst(const std::array<FF, LookupSettings::LOOKUP_TUPLE_SIZE>& tup) const = 0;
+    // Optional initialization step. The work can be split across num_threads threads.
+    virtual void init(TraceContainer&, [[maybe_unused]] size_t num_threads){};
+
+  private:
+    void process_with_threads(TraceContainer& trace, size_t num_threads)
     {
-        init(trace);
+        init(trace, num_threads);
 
         SetDummyInverses<LookupSettings_>(trace);
 
@@ -31,19 +49,28 @@ template <typename LookupSettings_> class BaseLookupTraceBuilder : public Intera
         // find a row dst_row in the target columns {d1, d2, ...} where the values match.
         // Then we increment the count in the counts column at dst_row.
         // The complexity is O(|src_selector|) * O(find_in_dst).
-        trace.visit_column(LookupSettings::SRC_SELECTOR, [&](uint32_t row, const FF&) {
-            auto src_values = trace.get_multiple(LookupSettings::SRC_COLUMNS, row);
-            uint32_t dst_row = find_in_dst(src_values); // Assumes an efficient implementation.
-            assert(src_values == trace.get_multiple(LookupSettings::DST_COLUMNS, dst_row));
-
-            trace.set(LookupSettings::COUNTS, dst_row, trace.get(LookupSettings::COUNTS, dst_row) + 1);
+        std::vector<uint32_t> src_rows;
+        src_rows.reserve(trace.get_column_rows(LookupSettings::SRC_SELECTOR));
+        trace.visit_column(LookupSettings::SRC_SELECTOR, [&](uint32_t row, const FF&) { src_rows.push_back(row); });
+
+        // The source rows are split across threads, each of which counts into its own histogram.
+        std::vector<unordered_flat_map<uint32_t, uint32_t>> histograms(num_threads);
+        run_partitioned(num_threads, src_rows.size(), [&](size_t start, size_t end, size_t thread_index) {
+            auto& histogram = histograms[thread_index];
+            for (size_t i = start; i < end; ++i) {
+                auto src_values = trace.get_multiple(LookupSettings::SRC_COLUMNS, src_rows[i]);
+                uint32_t dst_row = find_in_dst(src_values); // Assumes an efficient implementation.
+                assert(src_values == trace.get_multiple(LookupSettings::DST_COLUMNS, dst_row));
+                ++histogram[dst_row];
+            }
         });
-    }
 
-  protected:
-    using LookupSettings = LookupSettings_;
-    virtual uint32_t find_in_dst(const std::array<FF, LookupSettings::LOOKUP_TUPLE_SIZE>& tup) const = 0;
-    virtual void init(TraceContainer&){}; // Optional initialization step.
+        for (const auto& histogram : histograms) {
+            for (const auto& [dst_row, count] : histogram) {
+                trace.set(LookupSettings::COUNTS, dst_row, trace.get(LookupSettings::COUNTS, dst_row) + count);
+            }
+        }
+    }
 };
 
 // This class is used when the lookup is into a non-precomputed table.
@@ -56,21 +83,57 @@ class LookupIntoDynamicTableGeneric : public BaseLookupTraceBuilder<LookupSettin
   public:
     virtual ~LookupIntoDynamicTableGeneric() = default;
 
+    size_t get_work_size(const TraceContainer& trace) const override
+    {
+        return trace.get_column_rows(LookupSettings::SRC_SELECTOR) +
+               trace.get_column_rows(LookupSettings::DST_SELECTOR);
+    }
+
   protected:
     using LookupSettings = LookupSettings_;
     using ArrayTuple = std::array<FF, LookupSettings::LOOKUP_TUPLE_SIZE>;
+    using RowIndex = unordered_flat_map<ArrayTuple, uint32_t>;
 
-    void init(TraceContainer& trace) override
+    // The index is sharded by tuple hash, so that each shard can be built by a different thread.
+    void init(TraceContainer& trace, size_t num_threads) override
     {
-        row_idx.reserve(trace.get_column_rows(LookupSettings::DST_SELECTOR));
-        trace.visit_column(LookupSettings::DST_SELECTOR, [&](uint32_t row, const FF&) {
-            auto dst_values = trace.get_multiple(LookupSettings::DST_COLUMNS, row);
-            row_idx.insert({ dst_values, row });
+        std::vector<uint32_t> dst_rows;
+        dst_rows.reserve(trace.get_column_rows(LookupSettings::DST_SELECTOR));
+        trace.visit_column(LookupSettings::DST_SELECTOR, [&](uint32_t row, const FF&) { dst_rows.push_back(row); });
+
+        // Each thread computes the tuples of a contiguous range of rows, and buckets them by the shard they go in.
+        std::vector<ArrayTuple> dst_values(dst_rows.size());
+        std::vector<std::vector<std::vector<uint32_t>>> buckets(num_threads,
+                                                                std::vector<std::vector<uint32_t>>(num_threads));
+        run_partitioned(num_threads, dst_rows.size(), [&](size_t start, size_t end, size_t thread_index) {
+            auto& thread_buckets = buckets[thread_index];
+            for (size_t i = start; i < end; ++i) {
+                dst_values[i] = trace.get_multiple(LookupSettings::DST_COLUMNS, dst_rows[i]);
+                thread_buckets[shard_of(dst_values[i], num_threads)].push_back(static_cast<uint32_t>(i));
+            }
+        });
+
+        // Each shard is then built from its own buckets only.
+        row_idx_shards = std::vector<RowIndex>(num_threads);
+        run_partitioned(num_threads, num_threads, [&](size_t, size_t, size_t shard) {
+            auto& row_idx = row_idx_shards[shard];
+            size_t shard_size = 0;
+            for (const auto& thread_buckets : buckets) {
+                shard_size += thread_buckets[shard].size();
+            }
+            row_idx.reserve(shard_size);
+            // Threads got increasing row ranges, so the first row holding a tuple is the one kept.
+            for (const auto& thread_buckets : buckets) {
+                for (uint32_t i : thread_buckets[shard]) {
+                    row_idx.insert({ dst_values[i], dst_rows[i] });
+                }
+            }
         });
     }
 
     uint32_t find_in_dst(const ArrayTuple& tup) const override
     {
+        const auto& row_idx = row_idx_shards[shard_of(tup, row_idx_shards.size())];
         auto it = row_idx.find(tup);
         if (it != row_idx.end()) {
             return it->second;
@@ -88,8 +151,13 @@ class LookupIntoDynamicTableGeneric : public BaseLookupTraceBuilder<LookupSettin
     }
 
   private:
+    static size_t shard_of(const ArrayTuple& tup, size_t num_shards)
+    {
+        return typename RowIndex::hasher{}(tup) % num_shards;
+    }
+
     // TODO: Using the whole tuple as the key is not memory efficient.
-    unordered_flat_map<ArrayTuple, uint32_t> row_idx;
+    std::vector<RowIndex> row_idx_shards;
 };
 
 // This class is used when the lookup is into a non-precomputed table.
@@ -105,6 +173,8 @@ template <typename LookupSettings> class LookupIntoDynamicTableSequential : publ
   public:
     ~LookupIntoDynamicTableSequential() override = default;
 
+    std::string_view get_name() const override { return LookupSettings::NAME; }
+
     void process(TraceContainer& trace) override
     {
         uint32_t dst_row = 0;
@@ -0,0 +1,85 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/generated/relations/lookups_ff_gt.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_builder.hpp"
+#include "barretenberg/vm2/tracegen/test_trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using C = Column;
+using lookup_a_hi_range = bb::avm2::lookup_ff_gt_a_hi_range_relation<FF>;
+
+constexpr uint32_t NUM_VALUES = 1000;
+
+// Every value is in the destination twice, so that the row that gets the counts is the first one. Value v is looked up
+// v % 5 times.
+TestTraceContainer make_trace()
+{
+    TestTraceContainer trace;
+    for (uint32_t copy = 0; copy < 2; ++copy) {
+        for (uint32_t value = 0; value < NUM_VALUES; ++value) {
+            const uint32_t row = 1 + (copy * NUM_VALUES) + value;
+            trace.set(C::range_check_sel, row, 1);
+            trace.set(C::range_check_value, row, value);
+            trace.set(C::range_check_rng_chk_bits, row, 128);
+        }
+    }
+
+    uint32_t row = 1;
+    for (uint32_t value = 0; value < NUM_VALUES; ++value) {
+        for (uint32_t i = 0; i < value % 5; ++i, ++row) {
+            trace.set(C::ff_gt_sel, row, 1);
+            trace.set(C::ff_gt_a_hi, row, value);
+            trace.set(C::ff_gt_constant_128, row, 128);
+        }
+    }
+    return trace;
+}
+
+TEST(LookupBuilderTest, GenericLookupCounts)
+{
+    TestTraceContainer trace = make_trace();
+    LookupIntoDynamicTableGeneric<lookup_a_hi_range::Settings>().process(trace);
+
+    const auto counts_col = lookup_a_hi_range::Settings::COUNTS;
+    for (uint32_t value = 0; value < NUM_VALUES; ++value) {
+        EXPECT_EQ(trace.get(counts_col, 1 + value), value % 5);
+        EXPECT_EQ(trace.get(counts_col, 1 + NUM_VALUES + value), 0);
+    }
+}
+
+TEST(LookupBuilderTest, ParallelGenericLookupCountsMatchSequential)
+{
+    TestTraceContainer trace = make_trace();
+    TestTraceContainer parallel_trace = trace;
+    LookupIntoDynamicTableGeneric<lookup_a_hi_range::Settings>().process(trace);
+    LookupIntoDynamicTableGeneric<lookup_a_hi_range::Settings>().process_parallel(parallel_trace);
+
+    const auto counts_col = lookup_a_hi_range::Settings::COUNTS;
+    EXPECT_GT(trace.get_column_rows(counts_col), 0U);
+    EXPECT_EQ(trace.get_column_rows(counts_col), parallel_trace.get_column_rows(counts_col));
+    for (uint32_t row = 0; row < trace.get_column_rows(counts_col); ++row) {
+        EXPECT_EQ(trace.get(counts_col, row), parallel_trace.get(counts_col, row));
+    }
+}
+
+TEST(LookupBuilderTest, GenericLookupFailsOnMissingTuple)
+{
+    TestTraceContainer trace = make_trace();
+    const uint32_t row = trace.get_column_rows(C::ff_gt_sel);
+    trace.set(C::ff_gt_sel, row, 1);
+    trace.set(C::ff_gt_a_hi, row, NUM_VALUES);
+    trace.set(C::ff_gt_constant_128, row, 128);
+
+    EXPECT_THROW(LookupIntoDynamicTableGeneric<lookup_a_hi_range::Settings>().process(trace), std::runtime_error);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
@@ -11,6 +11,7 @@ namespace bb::avm2::tracegen {
 template <typename PermutationSettings> class PermutationBuilder : public InteractionBuilderInterface {
   public:
     void process(TraceContainer& trace) override { SetDummyInverses<PermutationSettings>(trace); }
+    std::string_view get_name() const override { return PermutationSettings::NAME; }
 };
 
 } // namespace bb::avm2::tracegen
\ No newline at end of file
@@ -1,5 +1,10 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <vector>
+
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -13,16 +18,204 @@ constexpr auto clk_column = Column::precomputed_clk;
 
 } // namespace
 
+TraceContainer::Chunk* TraceContainer::ColumnStorage::find_chunk(uint32_t row) const
+{
+    if (row >= MAX_ROWS) {
+        return nullptr;
+    }
+    ChunkTable* table = chunks.load(std::memory_order_acquire);
+    return table == nullptr ? nullptr : (*table)[row >> CHUNK_SIZE_LOG2].load(std::memory_order_acquire);
+}
+
+TraceContainer::Chunk& TraceContainer::ColumnStorage::make_dense(uint32_t row)
+{
+    assert(row < MAX_ROWS);
+    // Chunks are only created with the lock held, so there is no need for a CAS.
+    ChunkTable* table = chunks.load(std::memory_order_relaxed);
+    if (table == nullptr) {
+        table = new ChunkTable();
+        chunks.store(table, std::memory_order_release);
+    }
+
+    const size_t chunk_index = row >> CHUNK_SIZE_LOG2;
+    auto& slot = (*table)[chunk_index];
+    Chunk* chunk = slot.load(std::memory_order_relaxed);
+    if (chunk != nullptr) {
+        return *chunk;
+    }
+
+    chunk = new Chunk();
+    chunk->fill(FF::zero());
+    const bool has_sparse_rows = sparse_counts != nullptr && (*sparse_counts)[chunk_index] > 0;
+    if (has_sparse_rows) {
+        const auto first_row = static_cast<uint32_t>(chunk_index << CHUNK_SIZE_LOG2);
+        for (uint32_t i = 0; i < CHUNK_SIZE; ++i) {
+            auto it = sparse_rows.find(first_row + i);
+            if (it != sparse_rows.end()) {
+                (*chunk)[i] = it->second;
+                sparse_rows.erase(it);
+            }
+        }
+        (*sparse_counts)[chunk_index] = 0;
+    }
+    // The chunk has to be visible before the rows leave the map for readers that skip the lock (see get()).
+    slot.store(chunk, std::memory_order_release);
+    if (has_sparse_rows) {
+        num_sparse_rows.store(sparse_rows.size(), std::memory_order_release);
+    }
+    return *chunk;
+}
+
+const FF& TraceContainer::ColumnStorage::get(uint32_t row) const
+{
+    if (num_sparse_rows.load(std::memory_order_acquire) == 0) {
+        // Any chunk made dense before the sparse rows ran out is visible here.
+        const Chunk* chunk = find_chunk(row);
+        return chunk == nullptr ? zero : (*chunk)[row & (CHUNK_SIZE - 1)];
+    }
+    if (const Chunk* chunk = find_chunk(row); chunk != nullptr) {
+        return (*chunk)[row & (CHUNK_SIZE - 1)];
+    }
+
+    std::shared_lock lock(sparse_mutex);
+    // The chunk might have been made dense since we looked.
+    if (const Chunk* chunk = find_chunk(row); chunk != nullptr) {
+        return (*chunk)[row & (CHUNK_SIZE - 1)];
+    }
+    const auto it = sparse_rows.find(row);
+    return it == sparse_rows.end() ? zero : it->second;
+}
+
+void TraceContainer::ColumnStorage::set(uint32_t row, const FF& value)
+{
+    Chunk* chunk = find_chunk(row);
+    if (chunk == nullptr) {
+        std::unique_lock lock(sparse_mutex);
+        // The chunk might have been made dense while we were waiting for the lock.
+        chunk = find_chunk(row);
+        if (chunk == nullptr) {
+            set_sparse(row, value);
+            return;
+        }
+    }
+    set_dense(*chunk, row, value);
+}
+
+void TraceContainer::ColumnStorage::set_dense(Chunk& chunk, uint32_t row, const FF& value)
+{
+    FF& cell = chunk[row & (CHUNK_SIZE - 1)];
+    if (!value.is_zero()) {
+        cell = value;
+        update_max_row(row);
+    } else if (!cell.is_zero()) {
+        cell = value;
+        if (max_row_number.load(std::memory_order_relaxed) == row) {
+            // This shouldn't happen often. We delay recalculation of the max row number
+            // until someone actually needs it.
+            row_number_dirty = true;
+        }
+    }
+}
+
+void TraceContainer::ColumnStorage::set_sparse(uint32_t row, const FF& value)
+{
+    const size_t chunk_index = row >> CHUNK_SIZE_LOG2;
+    if (value.is_zero()) {
+        if (sparse_rows.erase(row) == 0) {
+            return;
+        }
+        if (row < MAX_ROWS) {
+            --(*sparse_counts)[chunk_index];
+        }
+        num_sparse_rows.store(sparse_rows.size(), std::memory_order_release);
+        if (max_row_number.load(std::memory_order_relaxed) == row) {
+            row_number_dirty = true;
+        }
+        return;
+    }
+
+    const bool inserted = sparse_rows.insert_or_assign(row, value).second;
+    update_max_row(row);
+    if (!inserted) {
+        return;
+    }
+    num_sparse_rows.store(sparse_rows.size(), std::memory_order_release);
+    if (row >= MAX_ROWS) {
+        // Rows past the end of the trace are never made dense.
+        return;
+    }
+    if (sparse_counts == nullptr) {
+        sparse_counts = std::make_unique<std::array<uint16_t, NUM_CHUNKS>>();
+    }
+    if (++(*sparse_counts)[chunk_index] >= DENSE_CHUNK_THRESHOLD) {
+        make_dense(row);
+    }
+}
+
+void TraceContainer::ColumnStorage::update_max_row(uint32_t row)
+{
+    int64_t max_row = max_row_number.load(std::memory_order_relaxed);
+    while (max_row < static_cast<int64_t>(row) &&
+           !max_row_number.compare_exchange_weak(max_row, row, std::memory_order_relaxed)) {
+    }
+}
+
+int64_t TraceContainer::ColumnStorage::compute_max_row() const
+{
+    std::shared_lock lock(sparse_mutex);
+    int64_t max_row = -1;
+    for (const auto& entry : sparse_rows) {
+        max_row = std::max(max_row, static_cast<int64_t>(entry.first));
+    }
+    const ChunkTable* table = chunks.load(std::memory_order_acquire);
+    if (table == nullptr) {
+        return max_row;
+    }
+    // Dense chunks are scanned from the end, and only above the last sparse row.
+    for (size_t chunk_index = NUM_CHUNKS; chunk_index-- > 0;) {
+        const auto first_row = static_cast<int64_t>(chunk_index << CHUNK_SIZE_LOG2);
+        if (first_row + static_cast<int64_t>(CHUNK_SIZE) <= max_row) {
+            break;
+        }
+        const Chunk* chunk = (*table)[chunk_index].load(std::memory_order_acquire);
+        if (chunk == nullptr) {
+            continue;
+        }
+        for (size_t i = CHUNK_SIZE; i-- > 0;) {
+            if (!(*chunk)[i].is_zero()) {
+                return std::max(max_row, first_row + static_cast<int64_t>(i));
+            }
+        }
+    }
+    return max_row;
+}
+
+void TraceContainer::ColumnStorage::clear()
+{
+    ChunkTable* table = chunks.exchange(nullptr, std::memory_order_acq_rel);
+    if (table != nullptr) {
+        for (auto& slot : *table) {
+            delete slot.load(std::memory_order_relaxed);
+        }
+        delete table;
+    }
+    {
+        std::unique_lock lock(sparse_mutex);
+        sparse_rows.clear();
+        sparse_counts.reset();
+        num_sparse_rows = 0;
+    }
+    max_row_number = -1;
+    row_number_dirty = false;
+}
+
 TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    : trace(std::make_unique<std::array<ColumnStorage, NUM_COLUMNS_WITHOUT_SHIFTS>>())
 {}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::shared_lock lock(column_data.mutex);
-    const auto it = column_data.rows.find(row);
-    return it == column_data.rows.end() ? zero : it->second;
+    return (*trace)[static_cast<size_t>(col)].get(row);
 }
 
 const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row) const
@@ -35,19 +228,7 @@ const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row)
 
 void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    if (!value.is_zero()) {
-        column_data.rows.insert_or_assign(row, value);
-        column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
-    } else {
-        auto num_erased = column_data.rows.erase(row);
-        if (column_data.max_row_number == row && num_erased > 0) {
-            // This shouldn't happen often. We delay recalculation of the max row number
-            // until someone actually needs it.
-            column_data.row_number_dirty = true;
-        }
-    }
+    (*trace)[static_cast<size_t>(col)].set(row, value);
 }
 
 void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> values)
@@ -60,21 +241,19 @@ void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> va
 void TraceContainer::reserve_column(Column col, size_t size)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    column_data.rows.reserve(size);
+    std::unique_lock lock(column_data.sparse_mutex);
+    for (size_t row = 0; row < std::min(size, MAX_ROWS); row += CHUNK_SIZE) {
+        column_data.make_dense(static_cast<uint32_t>(row));
+    }
 }
 
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    if (column_data.row_number_dirty) {
+    if (column_data.row_number_dirty.exchange(false)) {
         // Trigger recalculation of max row number.
-        auto keys = std::views::keys(column_data.rows);
-        const auto it = std::max_element(keys.begin(), keys.end());
         // We use -1 to indicate that the column is empty.
-        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
-        column_data.row_number_dirty = false;
+        column_data.max_row_number = column_data.compute_max_row();
     }
     return static_cast<uint32_t>(column_data.max_row_number + 1);
 }
@@ -97,20 +276,94 @@ uint32_t TraceContainer::get_num_rows() const
 
 void TraceContainer::visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::shared_lock lock(column_data.mutex);
-    for (const auto& [row, value] : column_data.rows) {
-        visitor(row, value);
+    const auto& column_data = (*trace)[static_cast<size_t>(col)];
+
+    // Take a consistent snapshot of which chunks are dense and of the sparse rows, so that the visitor runs without
+    // holding the lock (and can read the column).
+    std::vector<std::pair<uint32_t, FF>> sparse_rows;
+    std::array<const Chunk*, NUM_CHUNKS> dense_chunks{};
+    {
+        std::shared_lock lock(column_data.sparse_mutex);
+        sparse_rows.assign(column_data.sparse_rows.begin(), column_data.sparse_rows.end());
+        for (size_t chunk_index = 0; chunk_index < NUM_CHUNKS; ++chunk_index) {
+            dense_chunks[chunk_index] = column_data.find_chunk(static_cast<uint32_t>(chunk_index << CHUNK_SIZE_LOG2));
+        }
+    }
+    std::sort(sparse_rows.begin(), sparse_rows.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // Rows are visited in ascending order. A chunk's rows are either all dense or all sparse.
+    auto sparse_it = sparse_rows.begin();
+    for (size_t chunk_index = 0; chunk_index < NUM_CHUNKS; ++chunk_index) {
+        const auto first_row = static_cast<uint32_t>(chunk_index << CHUNK_SIZE_LOG2);
+        const Chunk* chunk = dense_chunks[chunk_index];
+        if (chunk == nullptr) {
+            for (; sparse_it != sparse_rows.end() && sparse_it->first < first_row + CHUNK_SIZE; ++sparse_it) {
+                visitor(sparse_it->first, sparse_it->second);
+            }
+            continue;
+        }
+        for (uint32_t i = 0; i < CHUNK_SIZE; ++i) {
+            const FF& value = (*chunk)[i];
+            if (!value.is_zero()) {
+                visitor(first_row + i, value);
+            }
+        }
+    }
+    // Rows past the end of the trace.
+    for (; sparse_it != sparse_rows.end(); ++sparse_it) {
+        visitor(sparse_it->first, sparse_it->second);
+    }
+}
+
+void TraceContainer::copy_column_rows(Column col, uint32_t start_row, std::span<FF> dst) const
+{
+    const auto& column_data = (*trace)[static_cast<size_t>(col)];
+    // Chunks can't be made dense while we hold the lock, so sparse rows are exactly those not in a dense chunk.
+    std::shared_lock lock(column_data.sparse_mutex, std::defer_lock);
+    if (column_data.num_sparse_rows.load(std::memory_order_acquire) > 0) {
+        lock.lock();
+    }
+
+    size_t copied = 0;
+    while (copied < dst.size()) {
+        const size_t row = start_row + copied;
+        const size_t offset = row & (CHUNK_SIZE - 1);
+        const size_t count = std::min(CHUNK_SIZE - offset, dst.size() - copied);
+        const Chunk* chunk = column_data.find_chunk(static_cast<uint32_t>(row));
+        if (chunk == nullptr) {
+            std::fill_n(dst.begin() + static_cast<std::ptrdiff_t>(copied), count, FF::zero());
+        } else {
+            std::copy_n(chunk->begin() + static_cast<std::ptrdiff_t>(offset),
+                        count,
+                        dst.begin() + static_cast<std::ptrdiff_t>(copied));
+        }
+        copied += count;
+    }
+
+    if (lock.owns_lock()) {
+        for (const auto& [row, value] : column_data.sparse_rows) {
+            if (row >= start_row && row - start_row < dst.size()) {
+                dst[row - start_row] = value;
+            }
+        }
     }
 }
 
 void TraceContainer::clear_column(Column col)
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    column_data.rows.clear();
-    column_data.max_row_number = 0;
-    column_data.row_number_dirty = false;
+    (*trace)[static_cast<size_t>(col)].clear();
+}
+
+size_t TraceContainer::get_column_dense_chunks(Column col) const
+{
+    const auto& column_data = (*trace)[static_cast<size_t>(col)];
+    size_t num_dense_chunks = 0;
+    for (size_t chunk_index = 0; chunk_index < NUM_CHUNKS; ++chunk_index) {
+        if (column_data.find_chunk(static_cast<uint32_t>(chunk_index << CHUNK_SIZE_LOG2)) != nullptr) {
+            ++num_dense_chunks;
+        }
+    }
+    return num_dense_chunks;
 }
 
 } // namespace bb::avm2::tracegen
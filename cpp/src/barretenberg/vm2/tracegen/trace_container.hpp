@@ -2,13 +2,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <shared_mutex>
 #include <span>
-#include <unordered_map>
 
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
@@ -18,7 +19,14 @@
 namespace bb::avm2::tracegen {
 
 // This container is thread-safe.
-// Contention can only happen when concurrently accessing the same column.
+// Concurrent writes to different rows are always safe, even within the same column, and writes to the densely stored
+// parts of a column never block. Concurrent writes to the same row are not ordered.
+//
+// A reference returned by get() for a row that is stored sparsely (see below) can be invalidated by writes to other
+// rows of the column, so values should be copied if the column is being written concurrently.
+//
+// Any row can be written. Rows at or past MAX_ROWS (the size of the circuit) are kept like any other row, and count
+// towards the number of rows of their column, so that callers can detect that the trace is too large.
 class TraceContainer {
   public:
     TraceContainer();
@@ -57,26 +65,68 @@ class TraceContainer {
     // Number of columns (without shifts).
     static constexpr size_t num_columns() { return NUM_COLUMNS_WITHOUT_SHIFTS; }
 
+    // Copies the rows [start_row, start_row + dst.size()) of a column into dst. Unset rows are copied as zero.
+    void copy_column_rows(Column col, uint32_t start_row, std::span<FF> dst) const;
+
     // Free column memory.
     void clear_column(Column col);
 
+    // Number of chunks of a column that are stored densely. Mostly useful for tests and stats.
+    size_t get_column_dense_chunks(Column col) const;
+
+    static constexpr size_t CHUNK_SIZE_LOG2 = 12;
+    static constexpr size_t CHUNK_SIZE = 1UL << CHUNK_SIZE_LOG2;
+    static constexpr size_t MAX_ROWS = CIRCUIT_SUBGROUP_SIZE;
+    // A chunk is stored densely once it holds this many non-zero rows.
+    static constexpr size_t DENSE_CHUNK_THRESHOLD = CHUNK_SIZE / 8;
+
   private:
-    // We use a mutex per column to allow for concurrent writes.
-    // Observe that therefore concurrent write access to different columns is cheap.
-    struct SparseColumn {
-        std::shared_mutex mutex;
-        int64_t max_row_number = -1; // We use -1 to indicate that the column is empty.
-        bool row_number_dirty;       // Needs recalculation.
-        // Future memory optimization notes: we can do the same trick as in Operand.
-        // That is, store a variant with a unique_ptr. However, we should benchmark this.
-        // (see serialization.hpp).
-        unordered_flat_map<uint32_t, FF> rows;
+    // Columns are split in fixed size chunks of rows. A chunk starts out sparse: its non-zero rows are kept in a hash
+    // map shared by the whole column. Once it holds DENSE_CHUNK_THRESHOLD rows, it is moved to a dense array. Reads and
+    // writes of dense chunks are plain array accesses, and both the chunk table and the chunks are published with a
+    // CAS, so they need no locks. Nearly empty columns and untouched regions of a column therefore cost (almost) no
+    // memory, while the busy regions of a column are as cheap to access as a vector.
+    static constexpr size_t NUM_CHUNKS = MAX_ROWS / CHUNK_SIZE;
+    using Chunk = std::array<FF, CHUNK_SIZE>;
+    using ChunkTable = std::array<std::atomic<Chunk*>, NUM_CHUNKS>;
+
+    struct ColumnStorage {
+        std::atomic<ChunkTable*> chunks = nullptr;
+        // Non-zero rows of the chunks that are not dense, and of the rows past MAX_ROWS.
+        mutable std::shared_mutex sparse_mutex;
+        unordered_flat_map<uint32_t, FF> sparse_rows;
+        // Number of sparse rows in each chunk, allocated with the first sparse row.
+        std::unique_ptr<std::array<uint16_t, NUM_CHUNKS>> sparse_counts;
+        // Lets reads skip the lock when the column has no sparse rows. Only changes under the lock.
+        std::atomic<size_t> num_sparse_rows = 0;
+        // Upper bound on the maximum non-zero row. We use -1 to indicate that the column is empty.
+        std::atomic<int64_t> max_row_number = -1;
+        std::atomic<bool> row_number_dirty = false; // Needs recalculation.
+
+        ColumnStorage() = default;
+        ColumnStorage(const ColumnStorage&) = delete;
+        ColumnStorage& operator=(const ColumnStorage&) = delete;
+        ~ColumnStorage() { clear(); }
+
+        // Returns nullptr if the chunk holding the row is not dense.
+        Chunk* find_chunk(uint32_t row) const;
+        // Returns the dense chunk holding the row (below MAX_ROWS), moving its sparse rows into it if it was not dense.
+        // Must be called with the lock held.
+        Chunk& make_dense(uint32_t row);
+        // Returns zero if the row is not set.
+        const FF& get(uint32_t row) const;
+        void set(uint32_t row, const FF& value);
+        int64_t compute_max_row() const;
+        void clear();
+
+      private:
+        void set_dense(Chunk& chunk, uint32_t row, const FF& value);
+        // Must be called with the lock held, after checking that the row is not in a dense chunk.
+        void set_sparse(uint32_t row, const FF& value);
+        void update_max_row(uint32_t row);
     };
-    // We store the trace as a sparse matrix.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
-    // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
-    // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
-    std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+    std::unique_ptr<std::array<ColumnStorage, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
 };
 
 } // namespace bb::avm2::tracegen
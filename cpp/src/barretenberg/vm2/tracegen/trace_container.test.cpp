@@ -0,0 +1,163 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using testing::ElementsAre;
+using testing::Pair;
+
+TEST(TraceContainerTest, SetAndGetAcrossChunks)
+{
+    TraceContainer trace;
+    const Column col = Column::execution_sel;
+
+    trace.set(col, 0, 1);
+    trace.set(col, 5000, 2);
+    trace.set(col, CIRCUIT_SUBGROUP_SIZE - 1, 3);
+
+    EXPECT_EQ(trace.get(col, 0), 1);
+    EXPECT_EQ(trace.get(col, 1), 0);
+    EXPECT_EQ(trace.get(col, 5000), 2);
+    EXPECT_EQ(trace.get(col, CIRCUIT_SUBGROUP_SIZE - 1), 3);
+    // Reads past the end of the trace are zero, as needed by shifts.
+    EXPECT_EQ(trace.get(col, CIRCUIT_SUBGROUP_SIZE), 0);
+    EXPECT_EQ(trace.get_column_rows(col), CIRCUIT_SUBGROUP_SIZE);
+
+    std::vector<std::pair<uint32_t, FF>> visited;
+    trace.visit_column(col, [&](uint32_t row, const FF& value) { visited.emplace_back(row, value); });
+    EXPECT_THAT(visited, ElementsAre(Pair(0U, 1), Pair(5000U, 2), Pair(CIRCUIT_SUBGROUP_SIZE - 1, 3)));
+}
+
+TEST(TraceContainerTest, ZeroingMaxRowRecomputesRows)
+{
+    TraceContainer trace;
+    const Column col = Column::execution_sel;
+
+    trace.set(col, 10, 1);
+    trace.set(col, 20, 1);
+    EXPECT_EQ(trace.get_column_rows(col), 21U);
+
+    trace.set(col, 20, 0);
+    EXPECT_EQ(trace.get_column_rows(col), 11U);
+
+    trace.set(col, 10, 0);
+    EXPECT_EQ(trace.get_column_rows(col), 0U);
+    EXPECT_EQ(trace.get_num_rows(), 0U);
+}
+
+TEST(TraceContainerTest, CopyColumnRows)
+{
+    TraceContainer trace;
+    const Column col = Column::execution_sel;
+
+    trace.set(col, 1, 7);
+    trace.set(col, 4097, 8);
+
+    std::vector<FF> dst(4100, FF(42));
+    trace.copy_column_rows(col, 1, dst);
+    EXPECT_EQ(dst[0], 7);
+    EXPECT_EQ(dst[1], 0);
+    EXPECT_EQ(dst[4096], 8);
+    EXPECT_EQ(dst[4099], 0);
+
+    trace.clear_column(col);
+    EXPECT_EQ(trace.get_column_rows(col), 0U);
+    EXPECT_EQ(trace.get(col, 1), 0);
+}
+
+TEST(TraceContainerTest, LowOccupancyChunksStaySparse)
+{
+    TraceContainer trace;
+    const Column col = Column::execution_sel;
+
+    // A handful of rows spread over the column does not allocate any dense chunk.
+    for (uint32_t row = 0; row < CIRCUIT_SUBGROUP_SIZE; row += 100000) {
+        trace.set(col, row, row + 1);
+    }
+    EXPECT_EQ(trace.get_column_dense_chunks(col), 0U);
+    EXPECT_EQ(trace.get(col, 100000), 100001);
+    EXPECT_EQ(trace.get(col, 100001), 0);
+
+    // Filling a chunk past the threshold makes it dense, keeping the rows that were set while it was sparse.
+    const auto first_row = static_cast<uint32_t>(3 * TraceContainer::CHUNK_SIZE);
+    for (uint32_t i = 0; i < TraceContainer::DENSE_CHUNK_THRESHOLD; ++i) {
+        trace.set(col, first_row + (2 * i), 7);
+    }
+    EXPECT_EQ(trace.get_column_dense_chunks(col), 1U);
+    EXPECT_EQ(trace.get(col, first_row), 7);
+    EXPECT_EQ(trace.get(col, first_row + 1), 0);
+    EXPECT_EQ(trace.get(col, first_row + static_cast<uint32_t>(2 * (TraceContainer::DENSE_CHUNK_THRESHOLD - 1))), 7);
+    EXPECT_EQ(trace.get(col, 100000), 100001);
+
+    // Rows are visited in order, whether sparse or dense.
+    std::vector<uint32_t> visited_rows;
+    trace.visit_column(col, [&](uint32_t row, const FF&) { visited_rows.push_back(row); });
+    EXPECT_EQ(visited_rows.size(), (CIRCUIT_SUBGROUP_SIZE / 100000) + 1 + TraceContainer::DENSE_CHUNK_THRESHOLD);
+    EXPECT_TRUE(std::is_sorted(visited_rows.begin(), visited_rows.end()));
+
+    // Copies merge sparse and dense rows.
+    std::vector<FF> dst(TraceContainer::CHUNK_SIZE * 30, FF(42));
+    trace.copy_column_rows(col, 0, dst);
+    EXPECT_EQ(dst[0], 1);
+    EXPECT_EQ(dst[1], 0);
+    EXPECT_EQ(dst[first_row], 7);
+    EXPECT_EQ(dst[first_row + 1], 0);
+    EXPECT_EQ(dst[100000], 100001);
+
+    // Zeroing the last row recomputes the number of rows across sparse and dense rows.
+    const uint32_t last_row = (CIRCUIT_SUBGROUP_SIZE - 1) / 100000 * 100000;
+    EXPECT_EQ(trace.get_column_rows(col), last_row + 1);
+    trace.set(col, last_row, 0);
+    EXPECT_EQ(trace.get_column_rows(col), last_row - 100000 + 1);
+}
+
+TEST(TraceContainerTest, RowsPastTheEndOfTheTraceAreKept)
+{
+    TraceContainer trace;
+    const Column col = Column::execution_sel;
+
+    // Rows past the circuit size are stored like any other row, so that an oversized trace is detected by callers
+    // through the number of rows rather than lost.
+    trace.set(col, 5, 1);
+    trace.set(col, CIRCUIT_SUBGROUP_SIZE + 10, 2);
+    EXPECT_EQ(trace.get(col, CIRCUIT_SUBGROUP_SIZE + 10), 2);
+    EXPECT_EQ(trace.get(col, CIRCUIT_SUBGROUP_SIZE + 11), 0);
+    EXPECT_EQ(trace.get_column_rows(col), CIRCUIT_SUBGROUP_SIZE + 11);
+    EXPECT_GT(trace.get_num_rows(), CIRCUIT_SUBGROUP_SIZE);
+
+    std::vector<std::pair<uint32_t, FF>> visited;
+    trace.visit_column(col, [&](uint32_t row, const FF& value) { visited.emplace_back(row, value); });
+    EXPECT_THAT(visited, ElementsAre(Pair(5U, 1), Pair(CIRCUIT_SUBGROUP_SIZE + 10, 2)));
+
+    trace.set(col, CIRCUIT_SUBGROUP_SIZE + 10, 0);
+    EXPECT_EQ(trace.get_column_rows(col), 6U);
+}
+
+TEST(TraceContainerTest, ConcurrentWritesAcrossSparseAndDenseChunks)
+{
+    TraceContainer trace;
+    const Column col = Column::execution_sel;
+    constexpr auto num_rows = static_cast<uint32_t>(4 * TraceContainer::CHUNK_SIZE);
+
+    // Chunks are made dense while other threads are still writing to them.
+    parallel_for(num_rows, [&](size_t row) { trace.set(col, static_cast<uint32_t>(row), row + 1); });
+
+    EXPECT_EQ(trace.get_column_dense_chunks(col), 4U);
+    EXPECT_EQ(trace.get_column_rows(col), num_rows);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        EXPECT_EQ(trace.get(col, row), row + 1);
+    }
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
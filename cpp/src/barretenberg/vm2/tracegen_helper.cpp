@@ -2,6 +2,7 @@
 
 #include <array>
 #include <functional>
+#include <future>
 #include <span>
 #include <string>
 #include <vector>
@@ -43,6 +44,9 @@ using namespace bb::avm2::tracegen;
 
 namespace {
 
+// Interactions with at least this much work are split across all threads instead of sharing a thread pool slot.
+constexpr size_t PARALLEL_INTERACTION_MIN_WORK_SIZE = 1 << 14;
+
 auto build_precomputed_columns_jobs(TraceContainer& trace)
 {
     return std::vector<std::function<void()>>{
@@ -166,6 +170,169 @@ template <typename T> std::vector<T> concatenate_jobs(std::vector<T>&& first, au
     return result;
 }
 
+auto build_subtrace_jobs(TraceContainer& trace, EventsContainer& events)
+{
+    return std::vector<std::function<void()>>{
+        [&]() {
+            ExecutionTraceBuilder exec_builder;
+            AVM_TRACK_TIME("tracegen/execution", exec_builder.process(events.execution, trace));
+            clear_events(events.execution);
+        },
+        [&]() {
+            AddressDerivationTraceBuilder address_derivation_builder;
+            AVM_TRACK_TIME("tracegen/address_derivation",
+                           address_derivation_builder.process(events.address_derivation, trace));
+            clear_events(events.address_derivation);
+        },
+        [&]() {
+            AluTraceBuilder alu_builder;
+            AVM_TRACK_TIME("tracegen/alu", alu_builder.process(events.alu, trace));
+            clear_events(events.alu);
+        },
+        [&]() {
+            BytecodeTraceBuilder bytecode_builder;
+            AVM_TRACK_TIME("tracegen/bytecode_decomposition",
+                           bytecode_builder.process_decomposition(events.bytecode_decomposition, trace));
+            clear_events(events.bytecode_decomposition);
+        },
+        [&]() {
+            BytecodeTraceBuilder bytecode_builder;
+            AVM_TRACK_TIME("tracegen/bytecode_hashing",
+                           bytecode_builder.process_hashing(events.bytecode_hashing, trace));
+            clear_events(events.bytecode_hashing);
+        },
+        [&]() {
+            ClassIdDerivationTraceBuilder class_id_builder;
+            AVM_TRACK_TIME("tracegen/class_id_derivation", class_id_builder.process(events.class_id_derivation, trace));
+            clear_events(events.class_id_derivation);
+        },
+        [&]() {
+            BytecodeTraceBuilder bytecode_builder;
+            AVM_TRACK_TIME("tracegen/bytecode_retrieval",
+                           bytecode_builder.process_retrieval(events.bytecode_retrieval, trace));
+            clear_events(events.bytecode_retrieval);
+        },
+        [&]() {
+            BytecodeTraceBuilder bytecode_builder;
+            AVM_TRACK_TIME("tracegen/instruction_fetching",
+                           bytecode_builder.process_instruction_fetching(events.instruction_fetching, trace));
+            clear_events(events.instruction_fetching);
+        },
+        [&]() {
+            Sha256TraceBuilder sha256_builder(trace);
+            AVM_TRACK_TIME("tracegen/sha256_compression", sha256_builder.process(events.sha256_compression));
+            clear_events(events.sha256_compression);
+        },
+        [&]() {
+            EccTraceBuilder ecc_builder;
+            AVM_TRACK_TIME("tracegen/ecc_add", ecc_builder.process_add(events.ecc_add, trace));
+            clear_events(events.ecc_add);
+        },
+        [&]() {
+            EccTraceBuilder ecc_builder;
+            AVM_TRACK_TIME("tracegen/scalar_mul", ecc_builder.process_scalar_mul(events.scalar_mul, trace));
+            clear_events(events.scalar_mul);
+        },
+        [&]() {
+            Poseidon2TraceBuilder poseidon2_builder;
+            AVM_TRACK_TIME("tracegen/poseidon2_hash", poseidon2_builder.process_hash(events.poseidon2_hash, trace));
+            clear_events(events.poseidon2_hash);
+        },
+        [&]() {
+            Poseidon2TraceBuilder poseidon2_builder;
+            AVM_TRACK_TIME("tracegen/poseidon2_permutation",
+                           poseidon2_builder.process_permutation(events.poseidon2_permutation, trace));
+            clear_events(events.poseidon2_permutation);
+        },
+        [&]() {
+            ToRadixTraceBuilder to_radix_builder;
+            AVM_TRACK_TIME("tracegen/to_radix", to_radix_builder.process(events.to_radix, trace));
+            clear_events(events.to_radix);
+        },
+        [&]() {
+            FieldGreaterThanTraceBuilder field_gt_builder;
+            AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events.field_gt, trace));
+            clear_events(events.field_gt);
+        },
+        [&]() {
+            MerkleCheckTraceBuilder merkle_check_builder;
+            AVM_TRACK_TIME("tracegen/merkle_check", merkle_check_builder.process(events.merkle_check, trace));
+            clear_events(events.merkle_check);
+        },
+        [&]() {
+            RangeCheckTraceBuilder range_check_builder;
+            AVM_TRACK_TIME("tracegen/range_check", range_check_builder.process(events.range_check, trace));
+            clear_events(events.range_check);
+        },
+        [&]() {
+            PublicDataTreeCheckTraceBuilder public_data_tree_check_trace_builder;
+            AVM_TRACK_TIME("tracegen/public_data_tree_check",
+                           public_data_tree_check_trace_builder.process(events.public_data_tree_check_events, trace));
+            clear_events(events.public_data_tree_check_events);
+        },
+        [&]() {
+            UpdateCheckTraceBuilder update_check_trace_builder;
+            AVM_TRACK_TIME("tracegen/update_check",
+                           update_check_trace_builder.process(events.update_check_events, trace));
+            clear_events(events.update_check_events);
+        },
+        [&]() {
+            NullifierTreeCheckTraceBuilder nullifier_tree_check_trace_builder;
+            AVM_TRACK_TIME("tracegen/nullifier_tree_check",
+                           nullifier_tree_check_trace_builder.process(events.nullifier_tree_check_events, trace));
+            clear_events(events.nullifier_tree_check_events);
+        },
+        [&]() {
+            MemoryTraceBuilder memory_trace_builder;
+            AVM_TRACK_TIME("tracegen/memory", memory_trace_builder.process(events.memory, trace));
+            clear_events(events.memory);
+        },
+    };
+}
+
+void process_interactions(TraceContainer& trace)
+{
+    auto jobs_interactions = concatenate_jobs(Poseidon2TraceBuilder::lookup_jobs(),
+                                              RangeCheckTraceBuilder::lookup_jobs(),
+                                              BitwiseTraceBuilder::lookup_jobs(),
+                                              Sha256TraceBuilder::lookup_jobs(),
+                                              BytecodeTraceBuilder::lookup_jobs(),
+                                              ClassIdDerivationTraceBuilder::lookup_jobs(),
+                                              EccTraceBuilder::lookup_jobs(),
+                                              ToRadixTraceBuilder::lookup_jobs(),
+                                              AddressDerivationTraceBuilder::lookup_jobs(),
+                                              FieldGreaterThanTraceBuilder::lookup_jobs(),
+                                              MerkleCheckTraceBuilder::lookup_jobs(),
+                                              PublicDataTreeCheckTraceBuilder::lookup_jobs(),
+                                              UpdateCheckTraceBuilder::lookup_jobs(),
+                                              NullifierTreeCheckTraceBuilder::lookup_jobs(),
+                                              MemoryTraceBuilder::lookup_jobs());
+
+    // The largest interactions are the long pole. Each of them is split across all threads, one after the other.
+    // The remaining interactions are processed in parallel with each other, each on a single thread.
+    std::vector<InteractionBuilderInterface*> large_interactions;
+    std::vector<InteractionBuilderInterface*> small_interactions;
+    for (const auto& job : jobs_interactions) {
+        if (job->get_work_size(trace) >= PARALLEL_INTERACTION_MIN_WORK_SIZE) {
+            large_interactions.push_back(job.get());
+        } else {
+            small_interactions.push_back(job.get());
+        }
+    }
+
+    AVM_TRACK_TIME("tracegen/interactions", ({
+                       for (auto* job : large_interactions) {
+                           AVM_TRACK_TIME(std::string("tracegen/interactions/") + std::string(job->get_name()),
+                                          job->process_parallel(trace));
+                       }
+                       parallel_for(small_interactions.size(), [&](size_t i) {
+                           auto* job = small_interactions[i];
+                           AVM_TRACK_TIME(std::string("tracegen/interactions/") + std::string(job->get_name()),
+                                          job->process(trace));
+                       });
+                   }));
+}
+
 } // namespace
 
 TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const PublicInputs& public_inputs)
@@ -174,160 +341,53 @@ TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const
 
     // We process the events in parallel. Ideally the jobs should access disjoint column sets.
     {
-        auto jobs = concatenate(
-            // Precomputed column jobs.
-            build_precomputed_columns_jobs(trace),
-            // Public inputs column jobs.
-            build_public_inputs_columns_jobs(trace, public_inputs),
-            // Subtrace jobs.
-            std::vector<std::function<void()>>{
-                [&]() {
-                    ExecutionTraceBuilder exec_builder;
-                    AVM_TRACK_TIME("tracegen/execution", exec_builder.process(events.execution, trace));
-                    clear_events(events.execution);
-                },
-                [&]() {
-                    AddressDerivationTraceBuilder address_derivation_builder;
-                    AVM_TRACK_TIME("tracegen/address_derivation",
-                                   address_derivation_builder.process(events.address_derivation, trace));
-                    clear_events(events.address_derivation);
-                },
-                [&]() {
-                    AluTraceBuilder alu_builder;
-                    AVM_TRACK_TIME("tracegen/alu", alu_builder.process(events.alu, trace));
-                    clear_events(events.alu);
-                },
-                [&]() {
-                    BytecodeTraceBuilder bytecode_builder;
-                    AVM_TRACK_TIME("tracegen/bytecode_decomposition",
-                                   bytecode_builder.process_decomposition(events.bytecode_decomposition, trace));
-                    clear_events(events.bytecode_decomposition);
-                },
-                [&]() {
-                    BytecodeTraceBuilder bytecode_builder;
-                    AVM_TRACK_TIME("tracegen/bytecode_hashing",
-                                   bytecode_builder.process_hashing(events.bytecode_hashing, trace));
-                    clear_events(events.bytecode_hashing);
-                },
-                [&]() {
-                    ClassIdDerivationTraceBuilder class_id_builder;
-                    AVM_TRACK_TIME("tracegen/class_id_derivation",
-                                   class_id_builder.process(events.class_id_derivation, trace));
-                    clear_events(events.class_id_derivation);
-                },
-                [&]() {
-                    BytecodeTraceBuilder bytecode_builder;
-                    AVM_TRACK_TIME("tracegen/bytecode_retrieval",
-                                   bytecode_builder.process_retrieval(events.bytecode_retrieval, trace));
-                    clear_events(events.bytecode_retrieval);
-                },
-                [&]() {
-                    BytecodeTraceBuilder bytecode_builder;
-                    AVM_TRACK_TIME("tracegen/instruction_fetching",
-                                   bytecode_builder.process_instruction_fetching(events.instruction_fetching, trace));
-                    clear_events(events.instruction_fetching);
-                },
-                [&]() {
-                    Sha256TraceBuilder sha256_builder(trace);
-                    AVM_TRACK_TIME("tracegen/sha256_compression", sha256_builder.process(events.sha256_compression));
-                    clear_events(events.sha256_compression);
-                },
-                [&]() {
-                    EccTraceBuilder ecc_builder;
-                    AVM_TRACK_TIME("tracegen/ecc_add", ecc_builder.process_add(events.ecc_add, trace));
-                    clear_events(events.ecc_add);
-                },
-                [&]() {
-                    EccTraceBuilder ecc_builder;
-                    AVM_TRACK_TIME("tracegen/scalar_mul", ecc_builder.process_scalar_mul(events.scalar_mul, trace));
-                    clear_events(events.scalar_mul);
-                },
-                [&]() {
-                    Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_hash",
-                                   poseidon2_builder.process_hash(events.poseidon2_hash, trace));
-                    clear_events(events.poseidon2_hash);
-                },
-                [&]() {
-                    Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_permutation",
-                                   poseidon2_builder.process_permutation(events.poseidon2_permutation, trace));
-                    clear_events(events.poseidon2_permutation);
-                },
-                [&]() {
-                    ToRadixTraceBuilder to_radix_builder;
-                    AVM_TRACK_TIME("tracegen/to_radix", to_radix_builder.process(events.to_radix, trace));
-                    clear_events(events.to_radix);
-                },
-                [&]() {
-                    FieldGreaterThanTraceBuilder field_gt_builder;
-                    AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events.field_gt, trace));
-                    clear_events(events.field_gt);
-                },
-                [&]() {
-                    MerkleCheckTraceBuilder merkle_check_builder;
-                    AVM_TRACK_TIME("tracegen/merkle_check", merkle_check_builder.process(events.merkle_check, trace));
-                    clear_events(events.merkle_check);
-                },
-                [&]() {
-                    RangeCheckTraceBuilder range_check_builder;
-                    AVM_TRACK_TIME("tracegen/range_check", range_check_builder.process(events.range_check, trace));
-                    clear_events(events.range_check);
-                },
-                [&]() {
-                    PublicDataTreeCheckTraceBuilder public_data_tree_check_trace_builder;
-                    AVM_TRACK_TIME(
-                        "tracegen/public_data_tree_check",
-                        public_data_tree_check_trace_builder.process(events.public_data_tree_check_events, trace));
-                    clear_events(events.public_data_tree_check_events);
-                },
-                [&]() {
-                    UpdateCheckTraceBuilder update_check_trace_builder;
-                    AVM_TRACK_TIME("tracegen/update_check",
-                                   update_check_trace_builder.process(events.update_check_events, trace));
-                    clear_events(events.update_check_events);
-                },
-                [&]() {
-                    NullifierTreeCheckTraceBuilder nullifier_tree_check_trace_builder;
-                    AVM_TRACK_TIME(
-                        "tracegen/nullifier_tree_check",
-                        nullifier_tree_check_trace_builder.process(events.nullifier_tree_check_events, trace));
-                    clear_events(events.nullifier_tree_check_events);
-                },
-                [&]() {
-                    MemoryTraceBuilder memory_trace_builder;
-                    AVM_TRACK_TIME("tracegen/memory", memory_trace_builder.process(events.memory, trace));
-                    clear_events(events.memory);
-                },
-            });
+        auto jobs = concatenate(build_precomputed_columns_jobs(trace),
+                                build_public_inputs_columns_jobs(trace, public_inputs),
+                                build_subtrace_jobs(trace, events));
         AVM_TRACK_TIME("tracegen/traces", execute_jobs(jobs));
     }
 
     // Now we can compute lookups and permutations.
-    {
-        auto jobs_interactions = concatenate_jobs(Poseidon2TraceBuilder::lookup_jobs(),
-                                                  RangeCheckTraceBuilder::lookup_jobs(),
-                                                  BitwiseTraceBuilder::lookup_jobs(),
-                                                  Sha256TraceBuilder::lookup_jobs(),
-                                                  BytecodeTraceBuilder::lookup_jobs(),
-                                                  ClassIdDerivationTraceBuilder::lookup_jobs(),
-                                                  EccTraceBuilder::lookup_jobs(),
-                                                  ToRadixTraceBuilder::lookup_jobs(),
-                                                  AddressDerivationTraceBuilder::lookup_jobs(),
-                                                  FieldGreaterThanTraceBuilder::lookup_jobs(),
-                                                  MerkleCheckTraceBuilder::lookup_jobs(),
-                                                  PublicDataTreeCheckTraceBuilder::lookup_jobs(),
-                                                  UpdateCheckTraceBuilder::lookup_jobs(),
-                                                  NullifierTreeCheckTraceBuilder::lookup_jobs(),
-                                                  MemoryTraceBuilder::lookup_jobs());
+    process_interactions(trace);
 
-        AVM_TRACK_TIME("tracegen/interactions",
-                       parallel_for(jobs_interactions.size(), [&](size_t i) { jobs_interactions[i]->process(trace); }));
+    check_interactions(trace);
+    print_trace_stats(trace);
+    return trace;
+}
+
+std::future<void> AvmTraceGenHelper::start_event_independent_columns(TraceContainer& trace,
+                                                                     const PublicInputs& public_inputs)
+{
+    return std::async(std::launch::async, [&trace, &public_inputs]() {
+        // The jobs are run one after the other. Using the thread pool here would clash with whatever the caller
+        // runs in parallel in the meantime.
+        auto jobs = concatenate(build_precomputed_columns_jobs(trace),
+                                build_public_inputs_columns_jobs(trace, public_inputs));
+        AVM_TRACK_TIME("tracegen/event_independent_columns", ({
+                           for (auto& job : jobs) {
+                               job();
+                           }
+                       }));
+    });
+}
+
+void AvmTraceGenHelper::finish_trace(EventsContainer&& events,
+                                     TraceContainer& trace,
+                                     std::future<void>&& event_independent_columns)
+{
+    // The subtrace jobs write columns disjoint from the event independent ones, so they can run while those are
+    // still being generated.
+    {
+        auto jobs = build_subtrace_jobs(trace, events);
+        AVM_TRACK_TIME("tracegen/traces", execute_jobs(jobs));
     }
 
+    // Interactions read the precomputed and public inputs columns, so these must be done by now.
+    AVM_TRACK_TIME("tracegen/wait_event_independent_columns", event_independent_columns.get());
+    process_interactions(trace);
+
     check_interactions(trace);
     print_trace_stats(trace);
-    return trace;
 }
 
 TraceContainer AvmTraceGenHelper::generate_precomputed_columns()
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <future>
+
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
@@ -11,6 +13,16 @@ class AvmTraceGenHelper {
     AvmTraceGenHelper() = default;
 
     tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events, const PublicInputs& public_inputs);
+
+    // Pipelined trace generation. The columns that do not depend on the events (precomputed and public inputs) are
+    // generated in the background, e.g., while the caller simulates. The events are then drained into the same trace
+    // by finish_trace. Both the trace and the public inputs must outlive the returned future.
+    std::future<void> start_event_independent_columns(tracegen::TraceContainer& trace,
+                                                      const PublicInputs& public_inputs);
+    void finish_trace(simulation::EventsContainer&& events,
+                      tracegen::TraceContainer& trace,
+                      std::future<void>&& event_independent_columns);
+
     tracegen::TraceContainer generate_precomputed_columns();
     tracegen::TraceContainer generate_public_inputs_columns(const PublicInputs& public_inputs);
 };
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
@@ -246,4 +248,26 @@ struct WorldStateStatusFull {
         return os;
     }
 };
+
+struct StoreCompactionStats {
+    std::string name;
+    // The block number of the tree's unfinalised tip at the time the snapshot was taken
+    block_number_t blockNumber{ 0 };
+    uint64_t sourceFileSize{ 0 };
+    uint64_t compactedFileSize{ 0 };
+    uint64_t durationMs{ 0 };
+    // Rate at which the source store was processed
+    uint64_t bytesPerSecond{ 0 };
+
+    MSGPACK_FIELDS(name, blockNumber, sourceFileSize, compactedFileSize, durationMs, bytesPerSecond);
+};
+
+struct WorldStateCompactionResult {
+    std::vector<StoreCompactionStats> stores;
+    uint64_t durationMs{ 0 };
+    // True if every compacted store was captured at the same block, i.e. the copy is a valid world state
+    bool consistent{ false };
+
+    MSGPACK_FIELDS(stores, durationMs, consistent);
+};
 } // namespace bb::world_state
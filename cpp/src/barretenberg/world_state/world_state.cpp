@@ -14,8 +14,10 @@
 #include "barretenberg/world_state/tree_with_store.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state_stores.hpp"
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
@@ -178,6 +180,118 @@ void WorldState::copy_stores(const std::string& dstPath, bool compact) const
     std::for_each(_persistentStores->begin(), _persistentStores->end(), copyStore);
 }
 
+WorldStateCompactionResult WorldState::compact_stores(const std::string& dstPath,
+                                                      const CompactionProgressCallback& on_progress) const
+{
+    using clock = std::chrono::steady_clock;
+    auto elapsedMs = [](const clock::time_point& start) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start).count());
+    };
+
+    WorldStateCompactionResult result;
+    auto start = clock::now();
+    for (const LMDBTreeStore::SharedPtr& store : *_persistentStores) {
+        std::filesystem::path directory = dstPath;
+        directory /= store->get_name();
+        std::filesystem::create_directories(directory);
+
+        StoreCompactionStats stats;
+        stats.name = store->get_name();
+        stats.sourceFileSize = store->get_data_file_size();
+        auto storeStart = clock::now();
+        store->copy_store_snapshot(directory, true);
+        stats.durationMs = elapsedMs(storeStart);
+        stats.bytesPerSecond = stats.sourceFileSize * 1000 / std::max<uint64_t>(stats.durationMs, 1);
+
+        // Open the compacted copy to determine its size and the block at which the snapshot was taken
+        LMDBTreeStore compacted(directory, store->get_name(), store->get_map_size() / 1024, 1);
+        stats.compactedFileSize = compacted.get_data_file_size();
+        TreeMeta meta;
+        {
+            LMDBTreeStore::ReadTransaction::Ptr tx = compacted.create_read_transaction();
+            compacted.read_meta_data(meta, *tx);
+        }
+        stats.blockNumber = meta.unfinalisedBlockHeight;
+
+        result.stores.push_back(stats);
+        if (on_progress) {
+            on_progress(stats, result.stores.size());
+        }
+    }
+    result.durationMs = elapsedMs(start);
+    result.consistent = std::all_of(result.stores.begin(), result.stores.end(), [&](const StoreCompactionStats& s) {
+        return s.blockNumber == result.stores.front().blockNumber;
+    });
+    return result;
+}
+
+void WorldState::compact_stores_async(const std::string& dstPath,
+                                      const CompactionProgressCallback& on_progress,
+                                      const CompactionCompletionCallback& on_completion) const
+{
+    _maintenanceWorker->enqueue([=, this]() {
+        TypedResponse<WorldStateCompactionResult> response;
+        try {
+            response.inner = compact_stores(dstPath, on_progress);
+            response.success = true;
+        } catch (std::exception& e) {
+            response.success = false;
+            response.message = e.what();
+        }
+        on_completion(response);
+    });
+}
+
+void WorldState::set_deferred_sync(bool enabled)
+{
+    // NOTE: the calling code is expected to ensure no writes are in progress while toggling deferred syncs
+    bool wasEnabled = _deferredSync;
+    for (const LMDBTreeStore::SharedPtr& store : *_persistentStores) {
+        store->set_deferred_sync(enabled);
+    }
+    _deferredSync = enabled;
+    if (wasEnabled && !enabled) {
+        // flush anything that was committed while syncs were deferred
+        auto [success, message] = sync_stores();
+        if (!success) {
+            throw std::runtime_error(message);
+        }
+    }
+}
+
+std::pair<bool, std::string> WorldState::sync_stores()
+{
+    // Issue the flush for every store concurrently
+    std::atomic_bool success = true;
+    std::string message;
+    Signal signal(static_cast<uint32_t>(NUM_TREES));
+    for (const LMDBTreeStore::SharedPtr& store : *_persistentStores) {
+        _workers->enqueue([&, store]() {
+            try {
+                store->sync();
+            } catch (std::exception& e) {
+                bool expected = true;
+                if (success.compare_exchange_strong(expected, false)) {
+                    message = format("Failed to sync store ", store->get_name(), " Error: ", e.what());
+                }
+            }
+            signal.signal_decrement();
+        });
+    }
+    signal.wait_for_level(0);
+    return std::make_pair(success.load(), message);
+}
+
+std::vector<lmdblib::LMDBEnvironment::SyncMetrics> WorldState::get_sync_metrics() const
+{
+    std::vector<lmdblib::LMDBEnvironment::SyncMetrics> metrics;
+    for (const LMDBTreeStore::SharedPtr& store : *_persistentStores) {
+        metrics.push_back(store->get_sync_metrics());
+    }
+    return metrics;
+}
+
 Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 {
     std::unique_lock lock(mtx);
@@ -556,6 +670,9 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     }
 
     signal.wait_for_level(0);
+    if (_deferredSync && success) {
+        return sync_stores();
+    }
     return std::make_pair(success.load(), message);
 }
 
@@ -796,6 +913,12 @@ bool WorldState::set_finalised_block(const block_number_t& blockNumber)
             throw std::runtime_error(m.message);
         }
     }
+    if (_deferredSync) {
+        auto [synced, message] = sync_stores();
+        if (!synced) {
+            throw std::runtime_error(message);
+        }
+    }
     return true;
 }
 bool WorldState::unwind_block(const block_number_t& blockNumber, WorldStateStatusFull& status)
@@ -861,6 +984,12 @@ bool WorldState::unwind_block(const block_number_t& blockNumber, WorldStateStatu
     if (!success) {
         throw std::runtime_error(message);
     }
+    if (_deferredSync) {
+        auto [synced, syncMessage] = sync_stores();
+        if (!synced) {
+            throw std::runtime_error(syncMessage);
+        }
+    }
     remove_forks_for_block(blockNumber);
     return true;
 }
@@ -927,6 +1056,12 @@ bool WorldState::remove_historical_block(const block_number_t& blockNumber, Worl
     if (!success) {
         throw std::runtime_error(message);
     }
+    if (_deferredSync) {
+        auto [synced, syncMessage] = sync_stores();
+        if (!synced) {
+            throw std::runtime_error(syncMessage);
+        }
+    }
     remove_forks_for_block(blockNumber);
     return true;
 }
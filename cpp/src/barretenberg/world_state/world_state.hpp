@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -96,6 +97,48 @@ class WorldState {
      */
     void copy_stores(const std::string& dstPath, bool compact) const;
 
+    using CompactionProgressCallback = std::function<void(const StoreCompactionStats&, uint64_t storesCompleted)>;
+    using CompactionCompletionCallback = std::function<void(const TypedResponse<WorldStateCompactionResult>&)>;
+
+    /**
+     * @brief Writes a compacted copy of all underlying LMDB stores to the target directory without blocking writers
+     *
+     * Each store is copied from a read snapshot, so blocks can continue to be committed while compaction is in
+     * progress. The result reports the block at which each store was captured. The copy is only a valid world state if
+     * it is consistent, and can only replace the live data directory if no blocks were committed since, so the caller
+     * is expected to swap it in at a block boundary by re-opening the world state on it.
+     *
+     * @param dstPath Parent folder where the compacted trees will be written
+     * @param on_progress Optional callback invoked as each store is completed
+     */
+    WorldStateCompactionResult compact_stores(const std::string& dstPath,
+                                              const CompactionProgressCallback& on_progress = nullptr) const;
+
+    /**
+     * @brief Runs compact_stores on a dedicated background thread, leaving the tree worker pool free
+     */
+    void compact_stores_async(const std::string& dstPath,
+                              const CompactionProgressCallback& on_progress,
+                              const CompactionCompletionCallback& on_completion) const;
+
+    /**
+     * @brief Enables or disables deferred syncs across all trees
+     *
+     * When enabled, the individual tree commits no longer flush to disk as part of their LMDB write transactions.
+     * Instead, once every tree has committed, each store is flushed once, with the flushes of all stores issued
+     * concurrently. Each tree lives in its own LMDB environment, so this is still one fsync per store rather than a
+     * single fsync for the block, but the block waits for the slowest flush instead of one flush per tree commit.
+     * The same is applied to unwinding, finalising and removing historical blocks. Disabling flushes any pending data.
+     *
+     * @param enabled Whether tree commits should defer their syncs
+     */
+    void set_deferred_sync(bool enabled);
+
+    /**
+     * @brief Get the sync state of each of the underlying stores
+     */
+    std::vector<lmdblib::LMDBEnvironment::SyncMetrics> get_sync_metrics() const;
+
     /**
      * @brief Get tree metadata for a particular tree
      *
@@ -287,6 +330,9 @@ class WorldState {
     std::unordered_map<uint64_t, Fork::SharedPtr> _forks;
     uint64_t _forkId = 0;
     uint32_t _initial_header_generator_point;
+    bool _deferredSync = false;
+    // Background maintenance (compaction) runs here. Declared last so that it is joined before the stores are released
+    std::shared_ptr<bb::ThreadPool> _maintenanceWorker = std::make_shared<bb::ThreadPool>(1);
 
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
     void create_canonical_fork(const std::string& dataDir,
@@ -306,6 +352,9 @@ class WorldState {
 
     void validate_trees_are_equally_synched();
 
+    // Flushes every store, this is the point at which the data committed with deferred syncs becomes durable
+    std::pair<bool, std::string> sync_stores();
+
     static bool block_state_matches_world_state(const StateReference& block_state_ref,
                                                 const StateReference& tree_state_ref);
 
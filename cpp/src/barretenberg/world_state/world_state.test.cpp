@@ -577,6 +577,116 @@ TEST_F(WorldStateTest, CommitsAndRollsBackAllTrees)
         ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, PublicDataLeafValue(143, 1), false);
 }
 
+TEST_F(WorldStateTest, DeferredSyncPersistsAllTrees)
+{
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        ws.set_deferred_sync(true);
+
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42) });
+        ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { fr(42) });
+        ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(42) });
+        ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { NullifierLeafValue(142) });
+        ws.append_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, { PublicDataLeafValue(142, 1) });
+
+        WorldStateStatusFull status;
+        auto [success, message] = ws.commit(status);
+        EXPECT_TRUE(success);
+        EXPECT_EQ(status.meta.archiveTreeMeta.unfinalisedBlockHeight, 1);
+    }
+
+    // re-open the stores and verify everything committed with deferred syncs was persisted
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::L1_TO_L2_MESSAGE_TREE, 0, fr(42));
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 1, fr(42));
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, 128, NullifierLeafValue(142));
+    assert_leaf_value(
+        ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, 128, PublicDataLeafValue(142, 1));
+}
+
+TEST_F(WorldStateTest, DeferredSyncFlushesEachStoreOncePerCommit)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto expect_sync_metrics = [&](bool deferred, uint64_t syncs) {
+        auto metrics = ws.get_sync_metrics();
+        EXPECT_EQ(metrics.size(), NUM_TREES);
+        for (const auto& store_metrics : metrics) {
+            EXPECT_EQ(store_metrics.deferred, deferred);
+            EXPECT_EQ(store_metrics.syncs, syncs);
+        }
+    };
+
+    // by default the tree commits sync as part of their own write transactions
+    expect_sync_metrics(false, 0);
+    ws.set_deferred_sync(true);
+    expect_sync_metrics(true, 0);
+
+    // nothing is flushed until every tree has committed
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42) });
+    ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { NullifierLeafValue(142) });
+    expect_sync_metrics(true, 0);
+
+    WorldStateStatusFull status;
+    auto [success, message] = ws.commit(status);
+    EXPECT_TRUE(success);
+    expect_sync_metrics(true, 1);
+
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(43) });
+    expect_sync_metrics(true, 1);
+    ws.commit(status);
+    expect_sync_metrics(true, 2);
+
+    // disabling deferred syncs flushes whatever is pending
+    ws.set_deferred_sync(false);
+    expect_sync_metrics(false, 3);
+
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(44) });
+    ws.commit(status);
+    expect_sync_metrics(false, 3);
+}
+
+TEST_F(WorldStateTest, CompactStoresProducesOpenableCopy)
+{
+    std::string compacted_dir = random_temp_directory();
+    std::filesystem::create_directories(compacted_dir);
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42) });
+        ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(42) });
+        WorldStateStatusFull status;
+        ws.commit(status);
+
+        Signal signal(1);
+        uint64_t progressCalls = 0;
+        TypedResponse<WorldStateCompactionResult> response;
+        ws.compact_stores_async(
+            compacted_dir,
+            [&](const StoreCompactionStats&, uint64_t storesCompleted) { progressCalls = storesCompleted; },
+            [&](const TypedResponse<WorldStateCompactionResult>& result) {
+                response = result;
+                signal.signal_level(0);
+            });
+        signal.wait_for_level(0);
+
+        EXPECT_TRUE(response.success);
+        EXPECT_TRUE(response.inner.consistent);
+        EXPECT_EQ(response.inner.stores.size(), NUM_TREES);
+        EXPECT_EQ(progressCalls, NUM_TREES);
+        for (const auto& stats : response.inner.stores) {
+            EXPECT_EQ(stats.blockNumber, 1);
+            EXPECT_GT(stats.compactedFileSize, 0);
+        }
+    }
+
+    // the compacted copy is a complete world state in its own right
+    WorldState ws(
+        thread_pool_size, compacted_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 1, fr(42));
+    std::filesystem::remove_all(compacted_dir);
+}
+
 TEST_F(WorldStateTest, SyncExternalBlockFromEmpty)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);